@@ -49,6 +49,7 @@ struct Options {
   bool show_help, interactive, pause;
   string output_filepath;
   string output_pass;
+  string stats_filepath;
 } options;
 
 static void session_print(const string &str)
@@ -154,6 +155,10 @@ static void session_init()
   /* load scene */
   scene_init();
 
+  if (!options.stats_filepath.empty()) {
+    options.scene->enable_update_stats();
+  }
+
   /* add pass for output. */
   Pass *pass = options.scene->create_node<Pass>();
   pass->set_name(ustring(options.output_pass.c_str()));
@@ -163,8 +168,95 @@ static void session_init()
   options.session->start();
 }
 
+/* Escape a string for use inside a quoted JSON string. */
+static string json_escape_string(const string &str)
+{
+  string result;
+  result.reserve(str.size());
+  for (const char c : str) {
+    switch (c) {
+      case '"':
+        result += "\\\"";
+        break;
+      case '\\':
+        result += "\\\\";
+        break;
+      case '\n':
+        result += "\\n";
+        break;
+      case '\r':
+        result += "\\r";
+        break;
+      case '\t':
+        result += "\\t";
+        break;
+      default:
+        if ((unsigned char)c < 0x20) {
+          result += string_printf("\\u%04x", (unsigned int)c);
+        }
+        else {
+          result += c;
+        }
+        break;
+    }
+  }
+  return result;
+}
+
+/* Write render timings and memory usage of the finished session as JSON, so that renders of the
+ * same scene can be compared across builds and hardware. */
+static void session_write_stats()
+{
+  FILE *file = fopen(options.stats_filepath.c_str(), "w");
+  if (!file) {
+    fprintf(stderr, "Failed to open statistics file: %s\n", options.stats_filepath.c_str());
+    return;
+  }
+
+  Session *session = options.session;
+  const SceneUpdateStats *update_stats = options.scene->update_stats;
+
+  double total_time, render_time;
+  session->progress.get_time(total_time, render_time);
+  const int samples = session->progress.get_current_sample();
+
+  fprintf(file, "{\n");
+  fprintf(file,
+          "  \"file\": \"%s\",\n",
+          json_escape_string(path_filename(options.filepath)).c_str());
+  fprintf(file,
+          "  \"device\": \"%s\",\n",
+          json_escape_string(session->device->info.description).c_str());
+  fprintf(file, "  \"width\": %d,\n", options.width);
+  fprintf(file, "  \"height\": %d,\n", options.height);
+  fprintf(file, "  \"samples\": %d,\n", samples);
+  fprintf(file, "  \"total_time\": %f,\n", total_time);
+  fprintf(file, "  \"render_time\": %f,\n", render_time);
+  fprintf(file,
+          "  \"samples_per_second\": %f,\n",
+          (render_time > 0.0) ? samples / render_time : 0.0);
+  if (update_stats) {
+    fprintf(file, "  \"update_time\": {\n");
+    fprintf(file, "    \"geometry\": %f,\n", update_stats->geometry.times.total_time);
+    fprintf(file, "    \"image\": %f,\n", update_stats->image.times.total_time);
+    fprintf(file, "    \"light\": %f,\n", update_stats->light.times.total_time);
+    fprintf(file, "    \"object\": %f,\n", update_stats->object.times.total_time);
+    fprintf(file, "    \"svm\": %f,\n", update_stats->svm.times.total_time);
+    fprintf(file, "    \"scene\": %f\n", update_stats->scene.times.total_time);
+    fprintf(file, "  },\n");
+  }
+  fprintf(file, "  \"memory_peak\": %zu\n", session->stats.mem_peak);
+  fprintf(file, "}\n");
+
+  fclose(file);
+}
+
 static void session_exit()
 {
+  if (options.session && !options.stats_filepath.empty()) {
+    session_write_stats();
+  }
+
   if (options.session) {
     delete options.session;
     options.session = NULL;
@@ -414,6 +506,9 @@ static void options_parse(int argc, const char **argv)
              "--output %s",
              &options.output_filepath,
              "File path to write output image",
+             "--stats-json %s",
+             &options.stats_filepath,
+             "File path to write render statistics as JSON",
              "--threads %d",
              &options.session_params.threads,
              "CPU Rendering Threads",
@@ -407,6 +407,7 @@ void PathTrace::path_trace(RenderWork &render_work)
 
     const double work_time = time_dt() - work_start_time;
     work_balance_infos_[i].time_spent += work_time;
+    work_balance_infos_[i].work_done += work_balance_infos_[i].weight * num_samples;
     work_balance_infos_[i].occupancy = statistics.occupancy;
 
     VLOG_INFO << "Rendered " << num_samples << " samples in " << work_time << " seconds ("
@@ -345,7 +345,7 @@ void PathTraceWorkGPU::render_samples(RenderStatistics &statistics,
    * add more work (because tiles are smaller, so there is higher chance that more paths will
    * become busy after adding new tiles). This is especially important for the shadow catcher which
    * schedules work in halves of available number of paths. */
-  work_tile_scheduler_.set_max_num_path_states(max_num_paths_ / 8);
+  work_tile_scheduler_.set_max_num_path_states(max_num_paths_ / work_tile_path_states_divisor_);
   work_tile_scheduler_.set_accelerated_rt(
       (device_->get_bvh_layout_mask(device_scene_->data.kernel_features) & BVH_LAYOUT_OPTIX) != 0);
   work_tile_scheduler_.reset(effective_buffer_params_,
@@ -400,7 +400,21 @@ void PathTraceWorkGPU::render_samples(RenderStatistics &statistics,
     ++num_iterations;
   }
 
+  if (num_iterations == 0) {
+    return;
+  }
+
   statistics.occupancy = static_cast<float>(num_busy_accum) / num_iterations / max_num_paths_;
+
+  /* Adapt the work tile size for the next samples. With low occupancy, smaller tiles allow adding
+   * work more gradually as paths terminate. With high occupancy, larger tiles reduce the number of
+   * initialization kernel launches. */
+  if (statistics.occupancy < 0.5f) {
+    work_tile_path_states_divisor_ = min(work_tile_path_states_divisor_ * 2, 32);
+  }
+  else if (statistics.occupancy > 0.9f) {
+    work_tile_path_states_divisor_ = max(work_tile_path_states_divisor_ / 2, 4);
+  }
 }
 
 DeviceKernel PathTraceWorkGPU::get_most_queued_kernel() const
@@ -166,6 +166,11 @@ class PathTraceWorkGPU : public PathTraceWork {
    * this value more work will be scheduled. */
   int min_num_active_main_paths_;
 
+  /* The number of path states a single work tile may use is the maximum number of paths divided
+   * by this value. It is tuned after every render_samples() call based on the measured
+   * occupancy, since the best value depends on the device and the scene. */
+  int work_tile_path_states_divisor_ = 8;
+
   /* Maximum path index, effective number of paths used may be smaller than
    * the size of the integrator_state_ buffer so can avoid iterating over the
    * full buffer. */
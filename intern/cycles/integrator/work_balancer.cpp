@@ -38,9 +38,17 @@ static double calculate_total_time(const vector<WorkBalanceInfo> &work_balance_i
   return total_time;
 }
 
-/* The balance is based on equalizing time which devices spent performing a task. Assume that
- * average of the observed times is usable for estimating whether more or less work is to be
- * scheduled, and how difference in the work scheduling is needed. */
+/* How much the newly measured throughput contributes to the smoothed per-device estimate. Higher
+ * values react faster to changes in the scene, lower values are more robust against noise in the
+ * timing of short work. */
+static constexpr double THROUGHPUT_SMOOTH_FACTOR = 0.5;
+
+/* The balance is based on per-device throughput estimates: every device gets the share of work
+ * which is proportional to the amount of work it is able to perform per second. When the estimates
+ * are accurate this makes all devices finish at the same time after a single rebalance step,
+ * which matters for heterogeneous configurations where devices differ a lot in speed. The
+ * estimates are smoothed over rebalances, so that a single noisy measurement does not cause the
+ * work distribution to oscillate. */
 
 bool work_balance_do_rebalance(vector<WorkBalanceInfo> &work_balance_infos)
 {
@@ -49,39 +57,56 @@ bool work_balance_do_rebalance(vector<WorkBalanceInfo> &work_balance_infos)
   const double total_time = calculate_total_time(work_balance_infos);
   const double time_average = total_time / num_infos;
 
-  double total_weight = 0;
-  vector<double> new_weights;
-  new_weights.reserve(num_infos);
-
-  /* Equalize the overall average time. This means that we don't make it so every work will perform
-   * amount of work based on the current average, but that after the weights changes the time will
-   * equalize.
-   * Can think of it that if one of the devices is 10% faster than another, then one device needs
-   * to do 5% less of the current work, and another needs to do 5% more. */
-  const double lerp_weight = 1.0 / num_infos;
+  if (time_average <= 0.0) {
+    return false;
+  }
 
-  bool has_big_difference = false;
+  double total_throughput = 0;
+  vector<double> new_throughputs;
+  new_throughputs.reserve(num_infos);
 
   for (const WorkBalanceInfo &info : work_balance_infos) {
-    const double time_target = mix(info.time_spent, time_average, lerp_weight);
-    const double new_weight = info.weight * time_target / info.time_spent;
-    new_weights.push_back(new_weight);
-    total_weight += new_weight;
+    /* Guard against devices which did not report any time, treat them as very fast so they get
+     * more work to measure on the next iteration. */
+    const double time_spent = max(info.time_spent, time_average * 1e-3);
+    /* Devices which did not get any work measured since the last rebalance keep their weight as
+     * the amount of work, this only happens before any samples were rendered. */
+    const double work_done = (info.work_done > 0.0) ? info.work_done : info.weight;
+    const double measured_throughput = work_done / time_spent;
+    const double throughput = (info.throughput > 0.0) ? mix(info.throughput,
+                                                             measured_throughput,
+                                                             THROUGHPUT_SMOOTH_FACTOR) :
+                                                        measured_throughput;
+    new_throughputs.push_back(throughput);
+    total_throughput += throughput;
+  }
 
-    if (std::fabs(1.0 - time_target / time_average) > 0.02) {
+  /* Devices are considered balanced when the time they spent on the work is close to the
+   * average. */
+  bool has_big_difference = false;
+  for (const WorkBalanceInfo &info : work_balance_infos) {
+    if (std::fabs(1.0 - info.time_spent / time_average) > 0.02) {
       has_big_difference = true;
+      break;
     }
   }
 
+  /* Every rebalance consumes its measurement, so that the next one only looks at the work which
+   * was performed after it and does not count the same time twice in the smoothed throughput. */
+  for (int i = 0; i < num_infos; ++i) {
+    WorkBalanceInfo &info = work_balance_infos[i];
+    info.throughput = new_throughputs[i];
+    info.time_spent = 0;
+    info.work_done = 0;
+  }
+
   if (!has_big_difference) {
     return false;
   }
 
-  const double total_weight_inv = 1.0 / total_weight;
+  const double total_throughput_inv = 1.0 / total_throughput;
   for (int i = 0; i < num_infos; ++i) {
-    WorkBalanceInfo &info = work_balance_infos[i];
-    info.weight = new_weights[i] * total_weight_inv;
-    info.time_spent = 0;
+    work_balance_infos[i].weight = new_throughputs[i] * total_throughput_inv;
   }
 
   return true;
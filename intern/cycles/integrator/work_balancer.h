@@ -12,12 +12,20 @@ struct WorkBalanceInfo {
   /* Time spent performing corresponding work. */
   double time_spent = 0;
 
+  /* Amount of work performed during #time_spent, as the weight of the work multiplied by the
+   * number of samples rendered with that weight. */
+  double work_done = 0;
+
   /* Average occupancy of the device while performing the work. */
   float occupancy = 1.0f;
 
   /* Normalized weight, which is ready to be used for work balancing (like calculating fraction of
    * the big tile which is to be rendered on the device). */
   double weight = 1.0;
+
+  /* Smoothed estimate of the device throughput, measured as #work_done per second. Zero until the
+   * first rebalance has measured it. */
+  double throughput = 0;
 };
 
 /* Balance work for an initial render integration, before any statistics is known. */
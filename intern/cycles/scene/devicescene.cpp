@@ -6,6 +6,8 @@
 #include "device/device.h"
 #include "device/memory.h"
 
+#include "scene/stats.h"
+
 CCL_NAMESPACE_BEGIN
 
 DeviceScene::DeviceScene(Device *device)
@@ -62,4 +64,73 @@ DeviceScene::DeviceScene(Device *device)
   memset((void *)&data, 0, sizeof(data));
 }
 
+static void add_memory_entry(NamedSizeStats &stats, device_memory &mem)
+{
+  const size_t size = mem.memory_size();
+  if (size) {
+    stats.add_entry(NamedSizeEntry(mem.name, size));
+  }
+}
+
+void DeviceScene::collect_statistics(RenderStats *stats)
+{
+  DeviceSceneStats &device = stats->device;
+
+  add_memory_entry(device.bvh, bvh_nodes);
+  add_memory_entry(device.bvh, bvh_leaf_nodes);
+  add_memory_entry(device.bvh, object_node);
+  add_memory_entry(device.bvh, prim_type);
+  add_memory_entry(device.bvh, prim_visibility);
+  add_memory_entry(device.bvh, prim_index);
+  add_memory_entry(device.bvh, prim_object);
+  add_memory_entry(device.bvh, prim_time);
+
+  add_memory_entry(device.geometry, tri_verts);
+  add_memory_entry(device.geometry, tri_shader);
+  add_memory_entry(device.geometry, tri_vnormal);
+  add_memory_entry(device.geometry, tri_vindex);
+  add_memory_entry(device.geometry, tri_patch);
+  add_memory_entry(device.geometry, tri_patch_uv);
+  add_memory_entry(device.geometry, curves);
+  add_memory_entry(device.geometry, curve_keys);
+  add_memory_entry(device.geometry, curve_segments);
+  add_memory_entry(device.geometry, patches);
+  add_memory_entry(device.geometry, points);
+  add_memory_entry(device.geometry, points_shader);
+
+  add_memory_entry(device.attributes, attributes_map);
+  add_memory_entry(device.attributes, attributes_float);
+  add_memory_entry(device.attributes, attributes_float2);
+  add_memory_entry(device.attributes, attributes_float3);
+  add_memory_entry(device.attributes, attributes_float4);
+  add_memory_entry(device.attributes, attributes_uchar4);
+
+  add_memory_entry(device.objects, objects);
+  add_memory_entry(device.objects, object_motion_pass);
+  add_memory_entry(device.objects, object_motion);
+  add_memory_entry(device.objects, object_flag);
+  add_memory_entry(device.objects, object_volume_step);
+  add_memory_entry(device.objects, object_prim_offset);
+  add_memory_entry(device.objects, camera_motion);
+  add_memory_entry(device.objects, particles);
+
+  add_memory_entry(device.lights, light_distribution);
+  add_memory_entry(device.lights, lights);
+  add_memory_entry(device.lights, light_background_marginal_cdf);
+  add_memory_entry(device.lights, light_background_conditional_cdf);
+  add_memory_entry(device.lights, light_tree_nodes);
+  add_memory_entry(device.lights, light_tree_emitters);
+  add_memory_entry(device.lights, light_to_tree);
+  add_memory_entry(device.lights, object_to_tree);
+  add_memory_entry(device.lights, object_lookup_offset);
+  add_memory_entry(device.lights, triangle_to_tree);
+  add_memory_entry(device.lights, ies_lights);
+
+  add_memory_entry(device.shaders, svm_nodes);
+  add_memory_entry(device.shaders, shaders);
+
+  add_memory_entry(device.other, lookup_table);
+  add_memory_entry(device.other, sample_pattern_lut);
+}
+
 CCL_NAMESPACE_END
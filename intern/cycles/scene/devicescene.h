@@ -13,6 +13,8 @@
 
 CCL_NAMESPACE_BEGIN
 
+class RenderStats;
+
 class DeviceScene {
  public:
   /* BVH */
@@ -95,6 +97,9 @@ class DeviceScene {
   KernelData data;
 
   DeviceScene(Device *device);
+
+  /* Add memory used by the arrays to the device memory statistics. */
+  void collect_statistics(RenderStats *stats);
 };
 
 CCL_NAMESPACE_END
@@ -102,10 +102,16 @@ void GeometryManager::device_update_mesh(Device *,
                                dscene->tri_patch.need_realloc() ||
                                dscene->tri_patch_uv.need_realloc();
 
-    foreach (Geometry *geom, scene->geometry) {
+    /* Every geometry writes to its own range of the arrays, so they can be packed in parallel. */
+    parallel_for(size_t(0), scene->geometry.size(), [&](const size_t i) {
+      Geometry *geom = scene->geometry[i];
       if (geom->geometry_type == Geometry::MESH || geom->geometry_type == Geometry::VOLUME) {
         Mesh *mesh = static_cast<Mesh *>(geom);
 
+        if (progress.get_cancel()) {
+          return;
+        }
+
         if (mesh->shader_is_modified() || mesh->smooth_is_modified() ||
             mesh->triangles_is_modified() || copy_all_data)
         {
@@ -124,11 +130,11 @@ void GeometryManager::device_update_mesh(Device *,
                            &tri_patch[mesh->prim_offset],
                            &tri_patch_uv[mesh->vert_offset]);
         }
-
-        if (progress.get_cancel()) {
-          return;
-        }
       }
+    });
+
+    if (progress.get_cancel()) {
+      return;
     }
 
     /* vertex coordinates */
@@ -153,7 +159,8 @@ void GeometryManager::device_update_mesh(Device *,
                                dscene->curves.need_realloc() ||
                                dscene->curve_segments.need_realloc();
 
-    foreach (Geometry *geom, scene->geometry) {
+    parallel_for(size_t(0), scene->geometry.size(), [&](const size_t i) {
+      Geometry *geom = scene->geometry[i];
       if (geom->is_hair()) {
         Hair *hair = static_cast<Hair *>(geom);
 
@@ -163,17 +170,21 @@ void GeometryManager::device_update_mesh(Device *,
                                    hair->curve_first_key_is_modified();
 
         if (!curve_keys_co_modified && !curve_data_modified && !copy_all_data) {
-          continue;
+          return;
+        }
+        if (progress.get_cancel()) {
+          return;
         }
 
         hair->pack_curves(scene,
                           &curve_keys[hair->curve_key_offset],
                           &curves[hair->prim_offset],
                           &curve_segments[hair->curve_segment_offset]);
-        if (progress.get_cancel()) {
-          return;
-        }
       }
+    });
+
+    if (progress.get_cancel()) {
+      return;
     }
 
     dscene->curve_keys.copy_to_device_if_modified();
@@ -187,15 +198,17 @@ void GeometryManager::device_update_mesh(Device *,
     float4 *points = dscene->points.alloc(point_size);
     uint *points_shader = dscene->points_shader.alloc(point_size);
 
-    foreach (Geometry *geom, scene->geometry) {
-      if (geom->is_pointcloud()) {
+    parallel_for(size_t(0), scene->geometry.size(), [&](const size_t i) {
+      Geometry *geom = scene->geometry[i];
+      if (geom->is_pointcloud() && !progress.get_cancel()) {
         PointCloud *pointcloud = static_cast<PointCloud *>(geom);
         pointcloud->pack(
             scene, &points[pointcloud->prim_offset], &points_shader[pointcloud->prim_offset]);
-        if (progress.get_cancel()) {
-          return;
-        }
       }
+    });
+
+    if (progress.get_cancel()) {
+      return;
     }
 
     dscene->points.copy_to_device();
@@ -207,8 +220,9 @@ void GeometryManager::device_update_mesh(Device *,
 
     uint *patch_data = dscene->patches.alloc(patch_size);
 
-    foreach (Geometry *geom, scene->geometry) {
-      if (geom->is_mesh()) {
+    parallel_for(size_t(0), scene->geometry.size(), [&](const size_t i) {
+      Geometry *geom = scene->geometry[i];
+      if (geom->is_mesh() && !progress.get_cancel()) {
         Mesh *mesh = static_cast<Mesh *>(geom);
         mesh->pack_patches(&patch_data[mesh->patch_offset]);
 
@@ -216,11 +230,11 @@ void GeometryManager::device_update_mesh(Device *,
           mesh->patch_table->copy_adjusting_offsets(&patch_data[mesh->patch_table_offset],
                                                     mesh->patch_table_offset);
         }
-
-        if (progress.get_cancel()) {
-          return;
-        }
       }
+    });
+
+    if (progress.get_cancel()) {
+      return;
     }
 
     dscene->patches.copy_to_device();
@@ -90,6 +90,9 @@ class ImageMetaData {
 class ImageDeviceFeatures {
  public:
   bool has_nanovdb;
+  /* Maximum resolution of image textures, zero if unlimited. Loaders may use this to read a
+   * smaller mipmap level directly instead of the full resolution image. */
+  int texture_limit;
 };
 
 /* Image loader base class, that can be subclassed to load image data
@@ -169,7 +172,7 @@ class ImageHandle {
  * texture images and 3D volume images. */
 class ImageManager {
  public:
-  explicit ImageManager(const DeviceInfo &info);
+  explicit ImageManager(const DeviceInfo &info, int texture_limit = 0);
   ~ImageManager();
 
   ImageHandle add_image(const string &filename, const ImageParams &params);
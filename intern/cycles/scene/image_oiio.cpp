@@ -14,7 +14,7 @@ OIIOImageLoader::OIIOImageLoader(const string &filepath) : filepath(filepath) {}
 
 OIIOImageLoader::~OIIOImageLoader() {}
 
-bool OIIOImageLoader::load_metadata(const ImageDeviceFeatures & /*features*/,
+bool OIIOImageLoader::load_metadata(const ImageDeviceFeatures &features,
                                     ImageMetaData &metadata)
 {
   /* Perform preliminary checks, with meaningful logging. */
@@ -38,6 +38,22 @@ bool OIIOImageLoader::load_metadata(const ImageDeviceFeatures & /*features*/,
     return false;
   }
 
+  /* For mipmapped files (e.g. tiled TX or EXR files), read the largest level that fits within
+   * the texture limit, instead of reading the full resolution and scaling it down afterwards. */
+  miplevel = 0;
+  if (features.texture_limit > 0 && spec.depth <= 1) {
+    ImageSpec mip_spec;
+    while (max(spec.width, spec.height) > features.texture_limit &&
+           in->seek_subimage(0, miplevel + 1, mip_spec))
+    {
+      miplevel++;
+      spec = mip_spec;
+    }
+    if (miplevel > 0) {
+      VLOG_WORK << "Reading mipmap level " << miplevel << " of image " << name() << ".";
+    }
+  }
+
   metadata.width = spec.width;
   metadata.height = spec.height;
   metadata.depth = spec.depth;
@@ -92,6 +108,7 @@ bool OIIOImageLoader::load_metadata(const ImageDeviceFeatures & /*features*/,
 template<TypeDesc::BASETYPE FileFormat, typename StorageType>
 static void oiio_load_pixels(const ImageMetaData &metadata,
                              const unique_ptr<ImageInput> &in,
+                             const int miplevel,
                              const bool associate_alpha,
                              StorageType *pixels)
 {
@@ -111,7 +128,7 @@ static void oiio_load_pixels(const ImageMetaData &metadata,
   if (depth <= 1) {
     size_t scanlinesize = width * components * sizeof(StorageType);
     in->read_image(0,
-                   0,
+                   miplevel,
                    0,
                    components,
                    FileFormat,
@@ -121,7 +138,7 @@ static void oiio_load_pixels(const ImageMetaData &metadata,
                    AutoStride);
   }
   else {
-    in->read_image(0, 0, 0, components, FileFormat, (uchar *)readpixels);
+    in->read_image(0, miplevel, 0, components, FileFormat, (uchar *)readpixels);
   }
 
   if (components > 4) {
@@ -219,20 +236,23 @@ bool OIIOImageLoader::load_pixels(const ImageMetaData &metadata,
   switch (metadata.type) {
     case IMAGE_DATA_TYPE_BYTE:
     case IMAGE_DATA_TYPE_BYTE4:
-      oiio_load_pixels<TypeDesc::UINT8, uchar>(metadata, in, do_associate_alpha, (uchar *)pixels);
+      oiio_load_pixels<TypeDesc::UINT8, uchar>(
+          metadata, in, miplevel, do_associate_alpha, (uchar *)pixels);
       break;
     case IMAGE_DATA_TYPE_USHORT:
     case IMAGE_DATA_TYPE_USHORT4:
       oiio_load_pixels<TypeDesc::USHORT, uint16_t>(
-          metadata, in, do_associate_alpha, (uint16_t *)pixels);
+          metadata, in, miplevel, do_associate_alpha, (uint16_t *)pixels);
       break;
     case IMAGE_DATA_TYPE_HALF:
     case IMAGE_DATA_TYPE_HALF4:
-      oiio_load_pixels<TypeDesc::HALF, half>(metadata, in, do_associate_alpha, (half *)pixels);
+      oiio_load_pixels<TypeDesc::HALF, half>(
+          metadata, in, miplevel, do_associate_alpha, (half *)pixels);
       break;
     case IMAGE_DATA_TYPE_FLOAT:
     case IMAGE_DATA_TYPE_FLOAT4:
-      oiio_load_pixels<TypeDesc::FLOAT, float>(metadata, in, do_associate_alpha, (float *)pixels);
+      oiio_load_pixels<TypeDesc::FLOAT, float>(
+          metadata, in, miplevel, do_associate_alpha, (float *)pixels);
       break;
     case IMAGE_DATA_TYPE_NANOVDB_FLOAT:
     case IMAGE_DATA_TYPE_NANOVDB_FLOAT3:
@@ -29,6 +29,8 @@ class OIIOImageLoader : public ImageLoader {
 
  protected:
   ustring filepath;
+  /* Mipmap level to read, chosen in #load_metadata to fit within the texture limit. */
+  int miplevel = 0;
 };
 
 CCL_NAMESPACE_END
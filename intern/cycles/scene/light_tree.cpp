@@ -7,6 +7,7 @@
 #include "scene/object.h"
 
 #include "util/progress.h"
+#include "util/tbb.h"
 
 CCL_NAMESPACE_BEGIN
 
@@ -530,14 +531,71 @@ bool LightTree::should_split(LightTreeEmitter *emitters,
 
   middle = (start + end) / 2;
 
-  BoundBox centroid_bbox = BoundBox::empty;
-  for (int i = start; i < end; i++) {
-    centroid_bbox.grow((emitters + i)->centroid);
-  }
+  /* Nodes close to the root contain most of the emitters, and are only processed by a single task
+   * of the task pool. Compute their centroid bounds and buckets in parallel, so that scenes with
+   * many emissive triangles do not spend most of the build time in the first few levels. */
+  const bool use_parallel = num_emitters > MIN_EMITTERS_PER_THREAD;
+  const blocked_range<int> range(start, end, MIN_EMITTERS_PER_THREAD);
+
+  auto grow_centroid_bbox = [emitters](const blocked_range<int> &r, BoundBox bbox) {
+    for (int i = r.begin(); i < r.end(); i++) {
+      bbox.grow((emitters + i)->centroid);
+    }
+    return bbox;
+  };
+
+  auto join_centroid_bbox = [](BoundBox a, const BoundBox &b) {
+    a.grow(b);
+    return a;
+  };
+
+  const BoundBox centroid_bbox = use_parallel ? parallel_reduce(range,
+                                                                BoundBox(BoundBox::empty),
+                                                                grow_centroid_bbox,
+                                                                join_centroid_bbox) :
+                                                grow_centroid_bbox(range, BoundBox::empty);
 
   const float3 extent = centroid_bbox.size();
   const float max_extent = max4(extent.x, extent.y, extent.z, 0.0f);
 
+  /* Fill in buckets with emitters for all dimensions in a single pass over the emitters, where
+   * the centroid box is split into equal partitions. */
+  using LightTreeBuckets = std::array<std::array<LightTreeBucket, LightTreeBucket::num_buckets>,
+                                      3>;
+  auto fill_buckets = [&](const blocked_range<int> &r, LightTreeBuckets buckets) {
+    for (int i = r.begin(); i < r.end(); i++) {
+      const LightTreeEmitter *emitter = emitters + i;
+      for (int dim = 0; dim < 3; dim++) {
+        int bucket_idx = 0;
+        if (extent[dim] != 0.0f) {
+          bucket_idx = LightTreeBucket::num_buckets *
+                       (emitter->centroid[dim] - centroid_bbox.min[dim]) / extent[dim];
+          bucket_idx = clamp(bucket_idx, 0, LightTreeBucket::num_buckets - 1);
+        }
+        buckets[dim][bucket_idx].add(*emitter);
+      }
+    }
+    return buckets;
+  };
+
+  auto join_buckets = [](LightTreeBuckets a, const LightTreeBuckets &b) {
+    for (int dim = 0; dim < 3; dim++) {
+      for (int i = 0; i < LightTreeBucket::num_buckets; i++) {
+        a[dim][i] = a[dim][i] + b[dim][i];
+      }
+    }
+    return a;
+  };
+
+  /* The buckets accumulate floating point measures, use a deterministic reduction so that the
+   * split (and with that the tree and the render noise) does not change between builds. */
+  const LightTreeBuckets all_buckets = use_parallel ?
+                                           parallel_deterministic_reduce(range,
+                                                                         LightTreeBuckets(),
+                                                                         fill_buckets,
+                                                                         join_buckets) :
+                                           fill_buckets(range, LightTreeBuckets());
+
   /* Check each dimension to find the minimum splitting cost. */
   float total_cost = 0.0f;
   float min_cost = FLT_MAX;
@@ -550,19 +608,7 @@ bool LightTree::should_split(LightTreeEmitter *emitters,
 
     const float inv_extent = 1 / (centroid_bbox.size()[dim]);
 
-    /* Fill in buckets with emitters. */
-    std::array<LightTreeBucket, LightTreeBucket::num_buckets> buckets;
-    for (int i = start; i < end; i++) {
-      const LightTreeEmitter *emitter = emitters + i;
-
-      /* Place emitter into the appropriate bucket, where the centroid box is split into equal
-       * partitions. */
-      int bucket_idx = LightTreeBucket::num_buckets *
-                       (emitter->centroid[dim] - centroid_bbox.min[dim]) * inv_extent;
-      bucket_idx = clamp(bucket_idx, 0, LightTreeBucket::num_buckets - 1);
-
-      buckets[bucket_idx].add(*emitter);
-    }
+    const std::array<LightTreeBucket, LightTreeBucket::num_buckets> &buckets = all_buckets[dim];
 
     /* Precompute the left bucket measure cumulatively. */
     std::array<LightTreeBucket, LightTreeBucket::num_buckets - 1> left_buckets;
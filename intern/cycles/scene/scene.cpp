@@ -59,7 +59,7 @@ Scene::Scene(const SceneParams &params_, Device *device)
   light_manager = new LightManager();
   geometry_manager = new GeometryManager();
   object_manager = new ObjectManager();
-  image_manager = new ImageManager(device->info);
+  image_manager = new ImageManager(device->info, params.texture_limit);
   particle_system_manager = new ParticleSystemManager();
   bake_manager = new BakeManager();
   procedural_manager = new ProceduralManager();
@@ -460,6 +460,7 @@ void Scene::collect_statistics(RenderStats *stats)
 {
   geometry_manager->collect_statistics(this, stats);
   image_manager->collect_statistics(stats);
+  dscene.collect_statistics(stats);
 }
 
 void Scene::enable_update_stats()
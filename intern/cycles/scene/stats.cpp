@@ -222,6 +222,24 @@ string ImageStats::full_report(int indent_level)
   return result;
 }
 
+/* Device scene statistics. */
+
+DeviceSceneStats::DeviceSceneStats() {}
+
+string DeviceSceneStats::full_report(int indent_level)
+{
+  const string indent(indent_level * kIndentNumSpaces, ' ');
+  string result = "";
+  result += indent + "BVH:\n" + bvh.full_report(indent_level + 1);
+  result += indent + "Geometry:\n" + geometry.full_report(indent_level + 1);
+  result += indent + "Attributes:\n" + attributes.full_report(indent_level + 1);
+  result += indent + "Objects:\n" + objects.full_report(indent_level + 1);
+  result += indent + "Lights:\n" + lights.full_report(indent_level + 1);
+  result += indent + "Shaders:\n" + shaders.full_report(indent_level + 1);
+  result += indent + "Other:\n" + other.full_report(indent_level + 1);
+  return result;
+}
+
 /* Overall statistics. */
 
 RenderStats::RenderStats()
@@ -287,6 +305,7 @@ string RenderStats::full_report()
   string result = "";
   result += "Mesh statistics:\n" + mesh.full_report(1);
   result += "Image statistics:\n" + image.full_report(1);
+  result += "Device memory statistics:\n" + device.full_report(1);
   if (has_profiling) {
     result += "Kernel statistics:\n" + kernel.full_report(1);
     result += "Shader statistics:\n" + shaders.full_report(1);
@@ -161,6 +161,24 @@ class ImageStats {
   NamedSizeStats textures;
 };
 
+/* Statistics about memory used by the scene arrays on the device, grouped by the scene component
+ * which owns them. */
+class DeviceSceneStats {
+ public:
+  DeviceSceneStats();
+
+  /* Generate full human-readable report. */
+  string full_report(int indent_level = 0);
+
+  NamedSizeStats bvh;
+  NamedSizeStats geometry;
+  NamedSizeStats attributes;
+  NamedSizeStats objects;
+  NamedSizeStats lights;
+  NamedSizeStats shaders;
+  NamedSizeStats other;
+};
+
 /* Render process statistics. */
 class RenderStats {
  public:
@@ -176,6 +194,7 @@ class RenderStats {
 
   MeshStats mesh;
   ImageStats image;
+  DeviceSceneStats device;
   NamedNestedSampleStats kernel;
   NamedSampleCountStats shaders;
   NamedSampleCountStats objects;
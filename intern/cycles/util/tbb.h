@@ -26,6 +26,7 @@ CCL_NAMESPACE_BEGIN
 
 using tbb::blocked_range;
 using tbb::enumerable_thread_specific;
+using tbb::parallel_deterministic_reduce;
 using tbb::parallel_for;
 using tbb::parallel_for_each;
 using tbb::parallel_reduce;
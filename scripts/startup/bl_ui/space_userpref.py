@@ -2863,6 +2863,9 @@ class USERPREF_PT_experimental_prototypes(ExperimentalPanel, Panel):
                 ({"property": "enable_overlay_next"}, ("blender/blender/issues/102179", "#102179")),
                 ({"property": "use_animation_baklava"}, ("/blender/blender/issues/120406", "#120406")),
                 ({"property": "enable_new_cpu_compositor"}, ("/blender/blender/issues/125968", "#125968")),
+                ({"property": "use_autosave_journal"}, None),
+                ({"property": "use_background_save"}, None),
+                ({"property": "use_evict_invisible_evaluated_data"}, None),
             ),
         )
 
@@ -9,7 +9,10 @@
 #include "BKE_animsys.h"
 #include "BKE_fcurve.hh"
 
+#include "BLI_array.hh"
 #include "BLI_map.hh"
+#include "BLI_task.hh"
+#include "BLI_vector.hh"
 
 #include "evaluation_internal.hh"
 
@@ -140,7 +143,10 @@ static EvaluationResult evaluate_keyframe_strip(PointerRNA &animated_id_ptr,
     return {};
   }
 
-  EvaluationResult evaluation_result;
+  /* Resolve the RNA paths first, so that the F-Curves themselves can be evaluated in parallel. RNA
+   * path resolution is kept single-threaded, as it can touch ID properties and report errors. */
+  Vector<FCurve *> fcurves;
+  Vector<PathResolvedRNA> anim_rnas;
   for (FCurve *fcu : channelbag_for_slot->fcurves()) {
     /* Blatant copy of animsys_evaluate_fcurves(). */
 
@@ -159,8 +165,33 @@ static EvaluationResult evaluate_keyframe_strip(PointerRNA &animated_id_ptr,
       continue;
     }
 
-    const float curval = calculate_fcurve(&anim_rna, fcu, &offset_eval_context);
-    evaluation_result.store(fcu->rna_path, fcu->array_index, curval, anim_rna);
+    fcurves.append(fcu);
+    anim_rnas.append(anim_rna);
+  }
+
+  /* Evaluating an F-Curve only reads the F-Curve itself, so for rigs with many animated channels
+   * it pays off to spread the curves over threads. Small channel bags are evaluated in one chunk
+   * to avoid the threading overhead. */
+  Array<float> values(fcurves.size());
+  threading::parallel_for(fcurves.index_range(), 256, [&](const IndexRange range) {
+    for (const int64_t i : range) {
+      if (fcurves[i]->driver == nullptr) {
+        values[i] = evaluate_fcurve(fcurves[i], offset_eval_context.eval_time);
+      }
+    }
+  });
+
+  EvaluationResult evaluation_result;
+  for (const int64_t i : fcurves.index_range()) {
+    FCurve *fcu = fcurves[i];
+    if (fcu->driver) {
+      values[i] = calculate_fcurve(&anim_rnas[i], fcu, &offset_eval_context);
+    }
+    else {
+      /* Debug display only, written here as the F-Curves are shared between threads above. */
+      fcu->curval = values[i];
+    }
+    evaluation_result.store(fcu->rna_path, fcu->array_index, values[i], anim_rnas[i]);
   }
 
   return evaluation_result;
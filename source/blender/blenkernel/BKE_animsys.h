@@ -44,6 +44,10 @@ typedef struct AnimationEvalContext {
    * example when evaluating NLA strips. This means that, even though the current time is stored in
    * the dependency graph, we need an explicit evaluation time. */
   float eval_time;
+
+  /* Resolved RNA paths of the targets of the driver being evaluated, may be null. Owned by the
+   * depsgraph operation evaluating the driver, see #BKE_animsys_eval_driver. */
+  struct DriverTargetPathCache *driver_path_cache;
 } AnimationEvalContext;
 
 AnimationEvalContext BKE_animsys_eval_context_construct(struct Depsgraph *depsgraph,
@@ -355,10 +359,14 @@ void animsys_evaluate_action_group(struct PointerRNA *ptr,
 struct Depsgraph;
 
 void BKE_animsys_eval_animdata(struct Depsgraph *depsgraph, struct ID *id);
+/**
+ * \param path_cache: Cache for the resolved target paths of this driver, may be null.
+ */
 void BKE_animsys_eval_driver(struct Depsgraph *depsgraph,
                              struct ID *id,
                              int driver_index,
-                             struct FCurve *fcu_orig);
+                             struct FCurve *fcu_orig,
+                             struct DriverTargetPathCache *path_cache);
 
 void BKE_animsys_update_driver_array(struct ID *id);
 
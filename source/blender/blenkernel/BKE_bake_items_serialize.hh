@@ -10,6 +10,8 @@
 
 #include "BKE_bake_items.hh"
 
+struct BLI_mmap_file;
+
 namespace blender::bke::bake {
 
 /**
@@ -151,10 +153,17 @@ class DiskBlobReader : public BlobReader {
  private:
   const std::string blobs_dir_;
   mutable std::mutex mutex_;
+  /**
+   * Blob files are memory mapped when possible. This allows reading slices without seeking in a
+   * stream, so that multiple slices can be read in parallel. A null value means that mapping the
+   * file failed and the stream is used instead.
+   */
+  mutable Map<std::string, BLI_mmap_file *> mapped_files_;
   mutable Map<std::string, std::unique_ptr<fstream>> open_input_streams_;
 
  public:
   DiskBlobReader(std::string blobs_dir);
+  ~DiskBlobReader();
   [[nodiscard]] bool read(const BlobSlice &slice, void *r_data) const override;
 };
 
@@ -86,6 +86,14 @@ typedef struct EffectorCache {
   struct GuideEffectorData *guide_data;
   float guide_loc[4], guide_dir[3], guide_radius;
 
+  /* Precalculated, to avoid looking these up for every effected point. */
+  /** Normalized world space Z axis of the effector object. */
+  float ob_zdir[3];
+  /** Evaluated mesh vertices for #PFIELD_SHAPE_POINTS, null when there is no mesh. */
+  const float (*points_positions)[3];
+  const float (*points_normals)[3];
+  int points_num;
+
   float frame;
   int flag;
 } EffectorCache;
@@ -132,6 +140,12 @@ void BKE_effectors_apply(struct ListBase *effectors,
                          float *wind_force,
                          float *impulse);
 void BKE_effectors_free(struct ListBase *lb);
+/**
+ * Reset the random number generators of the effectors (used for noise),
+ * so a list can be reused for multiple independent objects with the same results
+ * as creating a new list for each of them.
+ */
+void BKE_effectors_rng_reset(struct ListBase *effectors);
 
 void pd_point_from_particle(struct ParticleSimulationData *sim,
                             struct ParticleData *pa,
@@ -17,6 +17,7 @@ extern "C" {
 struct AnimationEvalContext;
 struct ChannelDriver;
 struct DriverTarget;
+struct DriverTargetPathCache;
 struct DriverVar;
 struct FCurve;
 struct PathResolvedRNA;
@@ -112,6 +113,13 @@ void driver_free_variable_ex(struct ChannelDriver *driver, struct DriverVar *dva
  * Change the type of driver variable.
  */
 void driver_change_variable_type(struct DriverVar *dvar, int type);
+/**
+ * Cache of the RNA paths the targets of a single driver resolved to, so that they are not parsed
+ * on every evaluation. Only valid as long as the variables of the driver don't change, so the
+ * depsgraph creates a new one whenever its relations are rebuilt.
+ */
+struct DriverTargetPathCache *driver_target_path_cache_new(void);
+void driver_target_path_cache_free(struct DriverTargetPathCache *cache);
 /**
  * Validate driver variable name (after being renamed).
  */
@@ -106,6 +106,23 @@ void normals_calc_verts(Span<float3> vert_positions,
                         Span<float3> face_normals,
                         MutableSpan<float3> vert_normals);
 
+/**
+ * Like #normals_calc_faces and #normals_calc_verts, but only recalculate the normals of the
+ * elements in the mask. The other values in the result array are left unchanged.
+ */
+void normals_calc_faces(Span<float3> vert_positions,
+                        OffsetIndices<int> faces,
+                        Span<int> corner_verts,
+                        const IndexMask &mask,
+                        MutableSpan<float3> face_normals);
+void normals_calc_verts(Span<float3> vert_positions,
+                        OffsetIndices<int> faces,
+                        Span<int> corner_verts,
+                        GroupedSpan<int> vert_to_face_map,
+                        Span<float3> face_normals,
+                        const IndexMask &mask,
+                        MutableSpan<float3> vert_normals);
+
 /** \} */
 
 /* -------------------------------------------------------------------- */
@@ -94,6 +94,14 @@ struct LooseEdgeCache : public LooseGeomCache {};
  */
 struct LooseVertCache : public LooseGeomCache {};
 
+/**
+ * Storage for a cached topology map, accessed as a #GroupedSpan.
+ */
+struct GroupedIndicesCache {
+  Array<int> offsets;
+  Array<int> indices;
+};
+
 struct TrianglesCache {
   SharedCache<Array<int3>> data;
   bool frozen = false;
@@ -210,6 +218,10 @@ struct MeshRuntime {
   SharedCache<Array<int>> vert_to_corner_map_cache;
   /** Cache of face indices for each face corner. */
   SharedCache<Array<int>> corner_to_face_map_cache;
+  /** Cache of the edges using each vertex. See #Mesh::vert_to_edge_map(). */
+  SharedCache<GroupedIndicesCache> vert_to_edge_map_cache;
+  /** Cache of the faces using each edge. See #Mesh::edge_to_face_map(). */
+  SharedCache<GroupedIndicesCache> edge_to_face_map_cache;
   /** Cache of data about edges not used by faces. See #Mesh::loose_edges(). */
   SharedCache<LooseEdgeCache> loose_edges_cache;
   /** Cache of data about vertices not used by edges. See #Mesh::loose_verts(). */
@@ -4158,7 +4158,11 @@ void BKE_animsys_update_driver_array(ID *id)
   }
 }
 
-void BKE_animsys_eval_driver(Depsgraph *depsgraph, ID *id, int driver_index, FCurve *fcu_orig)
+void BKE_animsys_eval_driver(Depsgraph *depsgraph,
+                             ID *id,
+                             int driver_index,
+                             FCurve *fcu_orig,
+                             DriverTargetPathCache *path_cache)
 {
   BLI_assert(fcu_orig != nullptr);
 
@@ -4196,8 +4200,9 @@ void BKE_animsys_eval_driver(Depsgraph *depsgraph, ID *id, int driver_index, FCu
       if (BKE_animsys_rna_path_resolve(&id_ptr, fcu->rna_path, fcu->array_index, &anim_rna)) {
         /* Evaluate driver, and write results to copy-on-eval-domain destination */
         const float ctime = DEG_get_ctime(depsgraph);
-        const AnimationEvalContext anim_eval_context = BKE_animsys_eval_context_construct(
-            depsgraph, ctime);
+        AnimationEvalContext anim_eval_context = BKE_animsys_eval_context_construct(depsgraph,
+                                                                                    ctime);
+        anim_eval_context.driver_path_cache = path_cache;
         const float curval = calculate_fcurve(&anim_rna, fcu, &anim_eval_context);
         ok = BKE_animsys_write_to_rna_path(&anim_rna, curval);
 
@@ -17,6 +17,7 @@
 
 #include "MEM_guardedalloc.h"
 
+#include "BLI_array.hh"
 #include "BLI_listbase.h"
 #include "BLI_math_matrix.h"
 #include "BLI_math_rotation.h"
@@ -201,7 +202,21 @@ static float dist_bone_deform(const bPoseChannel *pchan,
   return contrib;
 }
 
-static void pchan_bone_deform(const bPoseChannel *pchan,
+/**
+ * Deform settings of the bone a vertex group is assigned to, gathered once per evaluation so the
+ * per-weight loop doesn't have to look them up through the pose channel and bone for every
+ * vertex.
+ */
+struct ArmatureDeformGroup {
+  /** Null when the group isn't assigned to a deforming bone. */
+  const bPoseChannel *pchan;
+  /** Deform using the B-Bone segments of the bone. */
+  bool use_bbone;
+  /** Multiply the group weight with the bone envelope (#BONE_MULT_VG_ENV). */
+  bool use_envelope_multiply;
+};
+
+static void pchan_bone_deform(const ArmatureDeformGroup &group,
                               const float weight,
                               float vec[3],
                               DualQuat *dq,
@@ -210,13 +225,13 @@ static void pchan_bone_deform(const bPoseChannel *pchan,
                               const bool full_deform,
                               float *contrib)
 {
-  const Bone *bone = pchan->bone;
+  const bPoseChannel *pchan = group.pchan;
 
   if (!weight) {
     return;
   }
 
-  if (bone->segments > 1 && pchan->runtime.bbone_segments == bone->segments) {
+  if (group.use_bbone) {
     b_bone_deform(pchan, co, weight, vec, dq, mat, full_deform);
   }
   else {
@@ -252,7 +267,7 @@ struct ArmatureUserdata {
   const MDeformVert *dverts;
   int dverts_len;
 
-  bPoseChannel **pchan_from_defbase;
+  const ArmatureDeformGroup *deform_groups;
   int defbase_len;
 
   float premat[4][4];
@@ -344,18 +359,22 @@ static void armature_vert_task_with_dvert(const ArmatureUserdata *data,
     uint j;
     for (j = dvert->totweight; j != 0; j--, dw++) {
       const uint index = dw->def_nr;
-      if (index < data->defbase_len && (pchan = data->pchan_from_defbase[index])) {
+      if (index >= data->defbase_len) {
+        continue;
+      }
+      const ArmatureDeformGroup &group = data->deform_groups[index];
+      if (group.pchan) {
         float weight = dw->weight;
-        const Bone *bone = pchan->bone;
 
         deformed = 1;
 
-        if (bone && bone->flag & BONE_MULT_VG_ENV) {
+        if (group.use_envelope_multiply) {
+          const Bone *bone = group.pchan->bone;
           weight *= distfactor_to_bone(
               co, bone->arm_head, bone->arm_tail, bone->rad_head, bone->rad_tail, bone->dist);
         }
 
-        pchan_bone_deform(pchan, weight, vec, dq, smat, co, full_deform, &contrib);
+        pchan_bone_deform(group, weight, vec, dq, smat, co, full_deform, &contrib);
       }
     }
     /* If there are vertex-groups but not groups with bones (like for soft-body groups). */
@@ -493,7 +512,7 @@ static void armature_deform_coords_impl(const Object *ob_arm,
                                         bGPDstroke *gps_target)
 {
   const bArmature *arm = static_cast<const bArmature *>(ob_arm->data);
-  bPoseChannel **pchan_from_defbase = nullptr;
+  blender::Array<ArmatureDeformGroup> deform_groups;
   const bool use_envelope = (deformflag & ARM_DEF_ENVELOPE) != 0;
   const bool use_quaternion = (deformflag & ARM_DEF_QUATERNION) != 0;
   const bool invert_vgroup = (deformflag & ARM_DEF_INVERT_VGROUP) != 0;
@@ -557,21 +576,24 @@ static void armature_deform_coords_impl(const Object *ob_arm,
       }
 
       if (use_dverts) {
-        pchan_from_defbase = static_cast<bPoseChannel **>(
-            MEM_callocN(sizeof(*pchan_from_defbase) * defbase_len, "defnrToBone"));
+        deform_groups.reinitialize(defbase_len);
         /* TODO(sergey): Some considerations here:
          *
          * - Check whether keeping this consistent across frames gives speedup.
          */
         int i;
         LISTBASE_FOREACH_INDEX (bDeformGroup *, dg, defbase, i) {
-          pchan_from_defbase[i] = BKE_pose_channel_find_name(ob_arm->pose, dg->name);
+          ArmatureDeformGroup &group = deform_groups[i];
+          group = {};
+          const bPoseChannel *pchan = BKE_pose_channel_find_name(ob_arm->pose, dg->name);
           /* exclude non-deforming bones */
-          if (pchan_from_defbase[i]) {
-            if (pchan_from_defbase[i]->bone->flag & BONE_NO_DEFORM) {
-              pchan_from_defbase[i] = nullptr;
-            }
+          if (pchan == nullptr || (pchan->bone->flag & BONE_NO_DEFORM)) {
+            continue;
           }
+          const Bone *bone = pchan->bone;
+          group.pchan = pchan;
+          group.use_bbone = bone->segments > 1 && pchan->runtime.bbone_segments == bone->segments;
+          group.use_envelope_multiply = (bone->flag & BONE_MULT_VG_ENV) != 0;
         }
       }
     }
@@ -590,7 +612,7 @@ static void armature_deform_coords_impl(const Object *ob_arm,
   data.armature_def_nr = armature_def_nr;
   data.dverts = dverts.data();
   data.dverts_len = dverts.size();
-  data.pchan_from_defbase = pchan_from_defbase;
+  data.deform_groups = deform_groups.data();
   data.defbase_len = defbase_len;
   data.bmesh.cd_dvert_offset = cd_dvert_offset;
 
@@ -623,10 +645,6 @@ static void armature_deform_coords_impl(const Object *ob_arm,
     settings.min_iter_per_thread = 32;
     BLI_task_parallel_range(0, vert_coords_len, &data, armature_vert_task, &settings);
   }
-
-  if (pchan_from_defbase) {
-    MEM_freeN(pchan_from_defbase);
-  }
 }
 
 void BKE_armature_deform_coords_with_gpencil_stroke(const Object *ob_arm,
@@ -35,6 +35,7 @@
 #include "BLI_map.hh"
 #include "BLI_math_vector.h"
 #include "BLI_memarena.h"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
 #include "BLI_vector.hh"
 
@@ -226,6 +227,49 @@ static void link_append_context_library_blohandle_release(
   }
 }
 
+/**
+ * Number of library files opened ahead of linking, see
+ * #link_append_context_library_blohandles_ensure.
+ */
+#define LINK_APPEND_LIBRARY_OPEN_BATCH_SIZE 16
+
+/**
+ * Open the blend-file handles of the libraries in \a lib_range that still have items to link,
+ * concurrently. Opening a library is mostly IO latency (especially on network storage), and
+ * doesn't touch #Main, so libraries can be opened in parallel while linking remains serial.
+ */
+static void link_append_context_library_blohandles_ensure(BlendfileLinkAppendContext *lapp_context,
+                                                          const blender::IndexRange lib_range,
+                                                          ReportList *reports)
+{
+  blender::Vector<BlendfileLinkAppendContextLibrary *> libs_to_open;
+  for (const int lib_idx : lib_range) {
+    BlendfileLinkAppendContextLibrary *lib_context = lapp_context->libraries[lib_idx];
+    if (lib_context->blo_handle != nullptr) {
+      continue;
+    }
+    if (STREQ(lib_context->path, BLO_EMBEDDED_STARTUP_BLEND)) {
+      continue;
+    }
+    for (BlendfileLinkAppendContextItem *item : lapp_context->items) {
+      if (BLI_BITMAP_TEST(item->libraries, lib_idx)) {
+        libs_to_open.append(lib_context);
+        break;
+      }
+    }
+  }
+  if (libs_to_open.size() < 2) {
+    return;
+  }
+
+  blender::threading::parallel_for(
+      libs_to_open.index_range(), 1, [&](const blender::IndexRange range) {
+        for (const int i : range) {
+          link_append_context_library_blohandle_ensure(lapp_context, libs_to_open[i], reports);
+        }
+      });
+}
+
 BlendfileLinkAppendContext *BKE_blendfile_link_append_context_new(LibraryLink_Params *params)
 {
   BlendfileLinkAppendContext *lapp_context = MEM_new<BlendfileLinkAppendContext>(__func__);
@@ -1611,6 +1655,15 @@ void BKE_blendfile_link(BlendfileLinkAppendContext *lapp_context, ReportList *re
     BlendfileLinkAppendContextLibrary *lib_context = lapp_context->libraries[lib_idx];
     const char *libname = lib_context->path;
 
+    if (lib_idx % LINK_APPEND_LIBRARY_OPEN_BATCH_SIZE == 0) {
+      /* Bound the number of opened files (and the memory used by their headers). */
+      link_append_context_library_blohandles_ensure(
+          lapp_context,
+          lapp_context->libraries.index_range().drop_front(lib_idx).take_front(
+              LINK_APPEND_LIBRARY_OPEN_BATCH_SIZE),
+          reports);
+    }
+
     if (!link_append_context_library_blohandle_ensure(lapp_context, lib_context, reports)) {
       /* Unlikely since we just browsed it, but possible
        * Error reports will have been made by BLO_blendhandle_from_file() */
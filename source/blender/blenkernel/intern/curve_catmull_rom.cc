@@ -6,6 +6,7 @@
  * \ingroup bke
  */
 
+#include "BLI_array.hh"
 #include "BLI_task.hh"
 
 #include "BKE_attribute_math.hh"
@@ -47,15 +48,44 @@ static void evaluate_segment(const T &a, const T &b, const T &c, const T &d, Mut
   }
 }
 
+/**
+ * Same as above, but with the basis weights for every evaluated point of the segment computed in
+ * advance, since they are the same for all segments with the same resolution.
+ */
+template<typename T>
+static void evaluate_segment(const T &a,
+                             const T &b,
+                             const T &c,
+                             const T &d,
+                             const Span<float4> basis,
+                             MutableSpan<T> dst)
+{
+  if (basis.size() != dst.size()) {
+    evaluate_segment(a, b, c, d, dst);
+    return;
+  }
+  dst.first() = b;
+  for (const int i : dst.index_range().drop_front(1)) {
+    if constexpr (is_same_any_v<T, float, float2, float3>) {
+      dst[i] = 0.5f * attribute_math::mix4<T>(basis[i], a, b, c, d);
+    }
+    else {
+      dst[i] = attribute_math::mix4<T>(basis[i] * 0.5f, a, b, c, d);
+    }
+  }
+}
+
 /**
  * \param range_fn: Returns an index range describing where in the #dst span each segment should be
  * evaluated to, and how many points to add to it. This is used to avoid the need to allocate an
  * actual offsets array in typical evaluation use cases where the resolution is per-curve.
+ * \param basis: Optional precomputed basis weights, used for segments with the same size.
  */
 template<typename T, typename RangeForSegmentFn>
 static void interpolate_to_evaluated(const Span<T> src,
                                      const bool cyclic,
                                      const RangeForSegmentFn &range_fn,
+                                     const Span<float4> basis,
                                      MutableSpan<T> dst)
 
 {
@@ -104,7 +134,7 @@ static void interpolate_to_evaluated(const Span<T> src,
   threading::parallel_for(inner_range, 512, [&](IndexRange range) {
     for (const int i : range) {
       const IndexRange segment = range_fn(i);
-      evaluate_segment(src[i - 1], src[i], src[i + 1], src[i + 2], dst.slice(segment));
+      evaluate_segment(src[i - 1], src[i], src[i + 1], src[i + 2], basis, dst.slice(segment));
     }
   });
 }
@@ -117,12 +147,22 @@ static void interpolate_to_evaluated(const Span<T> src,
 
 {
   BLI_assert(dst.size() == calculate_evaluated_num(src.size(), cyclic, resolution));
+  /* All segments have the same resolution, so the basis weights only have to be computed once. */
+  Array<float4, 64> basis;
+  if (src.size() > 3) {
+    basis.reinitialize(resolution);
+    const float step = 1.0f / resolution;
+    for (const int i : basis.index_range()) {
+      basis[i] = calculate_basis(i * step);
+    }
+  }
   interpolate_to_evaluated(
       src,
       cyclic,
       [resolution](const int segment_i) -> IndexRange {
         return {segment_i * resolution, resolution};
       },
+      basis.as_span(),
       dst);
 }
 
@@ -139,6 +179,7 @@ static void interpolate_to_evaluated(const Span<T> src,
       [evaluated_offsets](const int segment_i) -> IndexRange {
         return evaluated_offsets[segment_i];
       },
+      {},
       dst);
 }
 
@@ -248,6 +248,11 @@ static bool offsets_contain_single_point(const OffsetIndices<int> offsets)
 struct ResultOffsets {
   /** The total number of curve combinations. */
   int total;
+  /**
+   * The number of profile curves. Combinations are ordered by main curve first, so the curve
+   * indices of a combination can be computed directly instead of being stored in arrays.
+   */
+  int profile_curves_num;
 
   /** Offsets into the result mesh for each combination. */
   Array<int> vert;
@@ -255,90 +260,72 @@ struct ResultOffsets {
   Array<int> loop;
   Array<int> face;
 
-  /* The indices of the main and profile curves that form each combination. */
-  Array<int> main_indices;
-  Array<int> profile_indices;
-
   /** Whether any curve in the profile or curve input has only a single evaluated point. */
   bool any_single_point_main;
   bool any_single_point_profile;
+
+  int main_index(const int combination) const
+  {
+    return combination / profile_curves_num;
+  }
+  int profile_index(const int combination) const
+  {
+    return combination % profile_curves_num;
+  }
 };
 static ResultOffsets calculate_result_offsets(const CurvesInfo &info, const bool fill_caps)
 {
   ResultOffsets result;
   result.total = info.main.curves_num() * info.profile.curves_num();
+  result.profile_curves_num = info.profile.curves_num();
 
   const OffsetIndices<int> main_offsets = info.main.evaluated_points_by_curve();
   const OffsetIndices<int> profile_offsets = info.profile.evaluated_points_by_curve();
 
+  result.vert.reinitialize(result.total + 1);
+  result.edge.reinitialize(result.total + 1);
+  result.loop.reinitialize(result.total + 1);
+  result.face.reinitialize(result.total + 1);
+
+  /* Count the elements of every combination in parallel first, then accumulate the counts. */
+  threading::parallel_for(IndexRange(result.total), 2048, [&](const IndexRange range) {
+    for (const int mesh_index : range) {
+      const int i_main = result.main_index(mesh_index);
+      const int i_profile = result.profile_index(mesh_index);
+
+      const bool main_cyclic = info.main_cyclic[i_main];
+      const int main_point_num = main_offsets[i_main].size();
+      const int main_segment_num = segments_num_no_duplicate_edge(main_point_num, main_cyclic);
+
+      const bool profile_cyclic = info.profile_cyclic[i_profile];
+      const int profile_point_num = profile_offsets[i_profile].size();
+      const int profile_segment_num = curves::segments_num(profile_point_num, profile_cyclic);
+
+      const bool has_caps = fill_caps && !main_cyclic && profile_cyclic && profile_point_num > 2;
+      const int tube_face_num = main_segment_num * profile_segment_num;
+
+      result.vert[mesh_index] = main_point_num * profile_point_num;
+
+      /* Add the ring edges, with one ring for every curve vertex, and the edge loops
+       * that run along the length of the curve, starting on the first profile. */
+      result.edge[mesh_index] = main_point_num * profile_segment_num +
+                                main_segment_num * profile_point_num;
+
+      /* Add two cap N-gons for every ending. */
+      result.face[mesh_index] = tube_face_num + (has_caps ? 2 : 0);
+
+      /* All faces on the tube are quads, and all cap faces are N-gons with an edge for each
+       * profile edge. */
+      result.loop[mesh_index] = tube_face_num * 4 + (has_caps ? profile_segment_num * 2 : 0);
+    }
+  });
+
   threading::parallel_invoke(
       result.total > 1024,
-      [&]() {
-        result.vert.reinitialize(result.total + 1);
-        result.edge.reinitialize(result.total + 1);
-        result.loop.reinitialize(result.total + 1);
-        result.face.reinitialize(result.total + 1);
-
-        int mesh_index = 0;
-        int vert_offset = 0;
-        int edge_offset = 0;
-        int loop_offset = 0;
-        int face_offset = 0;
-        for (const int i_main : main_offsets.index_range()) {
-          const bool main_cyclic = info.main_cyclic[i_main];
-          const int main_point_num = main_offsets[i_main].size();
-          const int main_segment_num = segments_num_no_duplicate_edge(main_point_num, main_cyclic);
-          for (const int i_profile : profile_offsets.index_range()) {
-            result.vert[mesh_index] = vert_offset;
-            result.edge[mesh_index] = edge_offset;
-            result.loop[mesh_index] = loop_offset;
-            result.face[mesh_index] = face_offset;
-
-            const bool profile_cyclic = info.profile_cyclic[i_profile];
-            const int profile_point_num = profile_offsets[i_profile].size();
-            const int profile_segment_num = curves::segments_num(profile_point_num,
-                                                                 profile_cyclic);
-
-            const bool has_caps = fill_caps && !main_cyclic && profile_cyclic &&
-                                  profile_point_num > 2;
-            const int tube_face_num = main_segment_num * profile_segment_num;
-
-            vert_offset += main_point_num * profile_point_num;
-
-            /* Add the ring edges, with one ring for every curve vertex, and the edge loops
-             * that run along the length of the curve, starting on the first profile. */
-            edge_offset += main_point_num * profile_segment_num +
-                           main_segment_num * profile_point_num;
-
-            /* Add two cap N-gons for every ending. */
-            face_offset += tube_face_num + (has_caps ? 2 : 0);
-
-            /* All faces on the tube are quads, and all cap faces are N-gons with an edge for each
-             * profile edge. */
-            loop_offset += tube_face_num * 4 + (has_caps ? profile_segment_num * 2 : 0);
-
-            mesh_index++;
-          }
-        }
-
-        result.vert.last() = vert_offset;
-        result.edge.last() = edge_offset;
-        result.loop.last() = loop_offset;
-        result.face.last() = face_offset;
-      },
-      [&]() {
-        result.main_indices.reinitialize(result.total);
-        result.profile_indices.reinitialize(result.total);
-
-        int mesh_index = 0;
-        for (const int i_main : main_offsets.index_range()) {
-          for (const int i_profile : profile_offsets.index_range()) {
-            result.main_indices[mesh_index] = i_main;
-            result.profile_indices[mesh_index] = i_profile;
-            mesh_index++;
-          }
-        }
-      },
+      [&]() { offset_indices::accumulate_counts_to_offsets(result.vert); },
+      [&]() { offset_indices::accumulate_counts_to_offsets(result.edge); },
+      [&]() { offset_indices::accumulate_counts_to_offsets(result.loop); },
+      [&]() { offset_indices::accumulate_counts_to_offsets(result.face); },
       [&]() { result.any_single_point_main = offsets_contain_single_point(main_offsets); },
       [&]() { result.any_single_point_profile = offsets_contain_single_point(profile_offsets); });
 
@@ -443,34 +430,41 @@ static void foreach_curve_combination(const CurvesInfo &info,
   const OffsetIndices<int> edge_offsets(offsets.edge);
   const OffsetIndices<int> face_offsets(offsets.face);
   const OffsetIndices<int> loop_offsets(offsets.loop);
-  threading::parallel_for(IndexRange(offsets.total), 512, [&](IndexRange range) {
-    for (const int i : range) {
-      const int i_main = offsets.main_indices[i];
-      const int i_profile = offsets.profile_indices[i];
-
-      const IndexRange main_points = main_offsets[i_main];
-      const IndexRange profile_points = profile_offsets[i_profile];
+  /* Balance the work by the number of vertices, since combinations can have very different sizes
+   * depending on the main and profile curve resolutions. */
+  threading::parallel_for(
+      IndexRange(offsets.total),
+      4096,
+      [&](IndexRange range) {
+        for (const int i : range) {
+          const int i_main = offsets.main_index(i);
+          const int i_profile = offsets.profile_index(i);
+
+          const IndexRange main_points = main_offsets[i_main];
+          const IndexRange profile_points = profile_offsets[i_profile];
 
-      const bool main_cyclic = info.main_cyclic[i_main];
-      const bool profile_cyclic = info.profile_cyclic[i_profile];
-
-      /* Pass all information in a struct to avoid repeating arguments in many lambdas.
-       * The idea is that inlining `fn` will help avoid accessing unnecessary information,
-       * though that may or may not happen in practice. */
-      fn(CombinationInfo{i_main,
-                         i_profile,
-                         main_points,
-                         profile_points,
-                         main_cyclic,
-                         profile_cyclic,
-                         curves::segments_num(main_points.size(), main_cyclic),
-                         curves::segments_num(profile_points.size(), profile_cyclic),
-                         vert_offsets[i],
-                         edge_offsets[i],
-                         face_offsets[i],
-                         loop_offsets[i]});
-    }
-  });
+          const bool main_cyclic = info.main_cyclic[i_main];
+          const bool profile_cyclic = info.profile_cyclic[i_profile];
+
+          /* Pass all information in a struct to avoid repeating arguments in many lambdas.
+           * The idea is that inlining `fn` will help avoid accessing unnecessary information,
+           * though that may or may not happen in practice. */
+          fn(CombinationInfo{i_main,
+                             i_profile,
+                             main_points,
+                             profile_points,
+                             main_cyclic,
+                             profile_cyclic,
+                             curves::segments_num(main_points.size(), main_cyclic),
+                             curves::segments_num(profile_points.size(), profile_cyclic),
+                             vert_offsets[i],
+                             edge_offsets[i],
+                             face_offsets[i],
+                             loop_offsets[i]});
+        }
+      },
+      threading::accumulated_task_sizes(
+          [&](const IndexRange range) { return vert_offsets[range].size(); }));
 }
 
 static void build_mesh_positions(const CurvesInfo &curves_info,
@@ -732,7 +726,8 @@ static void copy_profile_point_domain_attribute_to_mesh(const CurvesInfo &curves
 
 template<typename T>
 static void copy_indices_to_offset_ranges(const VArray<T> &src,
-                                          const Span<int> curve_indices,
+                                          const ResultOffsets &combinations,
+                                          const bool from_main_curves,
                                           const OffsetIndices<int> mesh_offsets,
                                           MutableSpan<T> dst)
 {
@@ -740,16 +735,22 @@ static void copy_indices_to_offset_ranges(const VArray<T> &src,
    * it's ever used for attributes), but the alternative is duplicating the function for spans and
    * other virtual arrays. */
   devirtualize_varray(src, [&](const auto src) {
-    threading::parallel_for(curve_indices.index_range(), 512, [&](IndexRange range) {
+    threading::parallel_for(IndexRange(combinations.total), 512, [&](IndexRange range) {
       for (const int i : range) {
-        dst.slice(mesh_offsets[i]).fill(src[curve_indices[i]]);
+        const int curve_index = from_main_curves ? combinations.main_index(i) :
+                                                   combinations.profile_index(i);
+        dst.slice(mesh_offsets[i]).fill(src[curve_index]);
       }
     });
   });
 }
 
+/**
+ * \param from_main_curves: Whether the source attribute is on the main curves, or on the profile
+ * curves otherwise.
+ */
 static void copy_curve_domain_attribute_to_mesh(const ResultOffsets &mesh_offsets,
-                                                const Span<int> curve_indices,
+                                                const bool from_main_curves,
                                                 const AttrDomain dst_domain,
                                                 const GVArray &src,
                                                 GMutableSpan dst)
@@ -774,7 +775,8 @@ static void copy_curve_domain_attribute_to_mesh(const ResultOffsets &mesh_offset
   }
   attribute_math::convert_to_static_type(src.type(), [&](auto dummy) {
     using T = decltype(dummy);
-    copy_indices_to_offset_ranges(src.typed<T>(), curve_indices, offsets, dst.typed<T>());
+    copy_indices_to_offset_ranges(
+        src.typed<T>(), mesh_offsets, from_main_curves, offsets, dst.typed<T>());
   });
 }
 
@@ -932,7 +934,7 @@ Mesh *curve_to_mesh_sweep(const CurvesGeometry &main,
           id, dst_domain, type);
       if (dst) {
         copy_curve_domain_attribute_to_mesh(
-            offsets, offsets.main_indices, dst_domain, *src, dst.span);
+            offsets, /*from_main_curves=*/true, dst_domain, *src, dst.span);
       }
       dst.finish();
     }
@@ -973,7 +975,7 @@ Mesh *curve_to_mesh_sweep(const CurvesGeometry &main,
     }
     else if (src_domain == AttrDomain::Curve) {
       copy_curve_domain_attribute_to_mesh(
-          offsets, offsets.profile_indices, dst_domain, src, dst.span);
+          offsets, /*from_main_curves=*/false, dst_domain, src, dst.span);
     }
 
     dst.finish();
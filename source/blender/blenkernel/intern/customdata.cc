@@ -3571,6 +3571,53 @@ void CustomData_free_elem(CustomData *data, const int index, const int count)
 
 #define SOURCE_BUF_SIZE 100
 
+template<typename T>
+static void customdata_interp_typed(const void *src_data,
+                                    const int *src_indices,
+                                    const float *weights,
+                                    const int count,
+                                    void *dest)
+{
+  const T *src = static_cast<const T *>(src_data);
+  T result(0.0f);
+  for (int i = 0; i < count; i++) {
+    result += src[src_indices[i]] * weights[i];
+  }
+  *static_cast<T *>(dest) = result;
+}
+
+/**
+ * Interpolate the most common generic attribute types directly from the source layer, instead of
+ * gathering element pointers and calling the #LayerTypeInfo.interp callback.
+ * Matches the result of the callbacks of these types (which ignore sub-weights).
+ *
+ * \return false when the type has no fast path.
+ */
+static bool customdata_interp_fast_path(const eCustomDataType type,
+                                        const void *src_data,
+                                        const int *src_indices,
+                                        const float *weights,
+                                        const int count,
+                                        void *dest)
+{
+  switch (type) {
+    case CD_PROP_FLOAT:
+      customdata_interp_typed<float>(src_data, src_indices, weights, count, dest);
+      return true;
+    case CD_PROP_FLOAT2:
+      customdata_interp_typed<blender::float2>(src_data, src_indices, weights, count, dest);
+      return true;
+    case CD_PROP_FLOAT3:
+      customdata_interp_typed<blender::float3>(src_data, src_indices, weights, count, dest);
+      return true;
+    case CD_PROP_COLOR:
+      customdata_interp_typed<blender::float4>(src_data, src_indices, weights, count, dest);
+      return true;
+    default:
+      return false;
+  }
+}
+
 void CustomData_interp(const CustomData *source,
                        CustomData *dest,
                        const int *src_indices,
@@ -3625,19 +3672,24 @@ void CustomData_interp(const CustomData *source,
 
     /* if we found a matching layer, copy the data */
     if (dest->layers[dest_i].type == source->layers[src_i].type) {
-      void *src_data = source->layers[src_i].data;
+      const void *src_data = source->layers[src_i].data;
+      void *dest_data = POINTER_OFFSET(dest->layers[dest_i].data,
+                                       size_t(dest_index) * typeInfo->size);
+
+      if (!customdata_interp_fast_path(eCustomDataType(source->layers[src_i].type),
+                                       src_data,
+                                       src_indices,
+                                       weights,
+                                       count,
+                                       dest_data))
+      {
+        for (int j = 0; j < count; j++) {
+          sources[j] = POINTER_OFFSET(src_data, size_t(src_indices[j]) * typeInfo->size);
+        }
 
-      for (int j = 0; j < count; j++) {
-        sources[j] = POINTER_OFFSET(src_data, size_t(src_indices[j]) * typeInfo->size);
+        typeInfo->interp(sources, weights, sub_weights, count, dest_data);
       }
 
-      typeInfo->interp(
-          sources,
-          weights,
-          sub_weights,
-          count,
-          POINTER_OFFSET(dest->layers[dest_i].data, size_t(dest_index) * typeInfo->size));
-
       /* if there are multiple source & dest layers of the same type,
        * we don't want to copy all source layers to the same dest, so
        * increment dest_i
@@ -126,12 +126,32 @@ void BKE_partdeflect_free(PartDeflect *pd)
 
 /******************** EFFECTOR RELATIONS ***********************/
 
+static uint effector_rng_seed(const EffectorCache *eff)
+{
+  const float ctime = DEG_get_ctime(eff->depsgraph);
+  const uint cfra = uint(ctime >= 0 ? ctime : -ctime);
+  return eff->pd->seed + cfra;
+}
+
 static void precalculate_effector(Depsgraph *depsgraph, EffectorCache *eff)
 {
   float ctime = DEG_get_ctime(depsgraph);
-  uint cfra = uint(ctime >= 0 ? ctime : -ctime);
 
-  eff->rng = BLI_rng_new(eff->pd->seed + cfra);
+  eff->rng = BLI_rng_new(effector_rng_seed(eff));
+
+  normalize_v3_v3(eff->ob_zdir, eff->ob->object_to_world().ptr()[2]);
+
+  if (eff->pd->shape == PFIELD_SHAPE_POINTS) {
+    /* TODO: hair and points object support */
+    if (const Mesh *mesh_eval = BKE_object_get_evaluated_mesh(eff->ob)) {
+      /* Also makes sure the normals are calculated before effectors are evaluated in threads. */
+      eff->points_positions = reinterpret_cast<const float(*)[3]>(
+          mesh_eval->vert_positions().data());
+      eff->points_normals = reinterpret_cast<const float(*)[3]>(
+          mesh_eval->vert_normals().data());
+      eff->points_num = mesh_eval->verts_num;
+    }
+  }
 
   if (eff->pd->forcefield == PFIELD_GUIDE && eff->ob->type == OB_CURVES_LEGACY) {
     Curve *cu = static_cast<Curve *>(eff->ob->data);
@@ -361,6 +381,15 @@ ListBase *BKE_effectors_create(Depsgraph *depsgraph,
   return effectors;
 }
 
+void BKE_effectors_rng_reset(ListBase *effectors)
+{
+  if (effectors) {
+    LISTBASE_FOREACH (EffectorCache *, eff, effectors) {
+      BLI_rng_seed(eff->rng, effector_rng_seed(eff));
+    }
+  }
+}
+
 void BKE_effectors_free(ListBase *lb)
 {
   if (lb) {
@@ -676,7 +705,6 @@ bool get_effector_data(EffectorCache *eff,
                        EffectedPoint *point,
                        int real_velocity)
 {
-  float cfra = DEG_get_ctime(eff->depsgraph);
   bool ret = false;
 
   /* In case surface object is in Edit mode when loading the .blend,
@@ -698,13 +726,9 @@ bool get_effector_data(EffectorCache *eff,
     efd->size = 0.0f;
   }
   else if (eff->pd && eff->pd->shape == PFIELD_SHAPE_POINTS) {
-    /* TODO: hair and points object support */
-    const Mesh *mesh_eval = BKE_object_get_evaluated_mesh(eff->ob);
-    if (mesh_eval != nullptr) {
-      const blender::Span<blender::float3> positions = mesh_eval->vert_positions();
-      const blender::Span<blender::float3> vert_normals = mesh_eval->vert_normals();
-      copy_v3_v3(efd->loc, positions[*efd->index]);
-      copy_v3_v3(efd->nor, vert_normals[*efd->index]);
+    if (eff->points_positions != nullptr) {
+      copy_v3_v3(efd->loc, eff->points_positions[*efd->index]);
+      copy_v3_v3(efd->nor, eff->points_normals[*efd->index]);
 
       mul_m4_v3(eff->ob->object_to_world().ptr(), efd->loc);
       mul_mat3_m4_v3(eff->ob->object_to_world().ptr(), efd->nor);
@@ -725,6 +749,7 @@ bool get_effector_data(EffectorCache *eff,
       /* pass */
     }
     else {
+      const float cfra = DEG_get_ctime(eff->depsgraph);
       ParticleSimulationData sim = {nullptr};
       sim.depsgraph = eff->depsgraph;
       sim.scene = eff->scene;
@@ -759,7 +784,7 @@ bool get_effector_data(EffectorCache *eff,
     const Object *ob = eff->ob;
 
     /* Use z-axis as normal. */
-    normalize_v3_v3(efd->nor, ob->object_to_world().ptr()[2]);
+    copy_v3_v3(efd->nor, eff->ob_zdir);
 
     if (eff->pd && ELEM(eff->pd->shape, PFIELD_SHAPE_PLANE, PFIELD_SHAPE_LINE)) {
       float temp[3], translate[3];
@@ -801,7 +826,7 @@ bool get_effector_data(EffectorCache *eff,
     else {
       /* for some effectors we need the object center every time */
       sub_v3_v3v3(efd->vec_to_point2, point->loc, eff->ob->object_to_world().location());
-      normalize_v3_v3(efd->nor2, eff->ob->object_to_world().ptr()[2]);
+      copy_v3_v3(efd->nor2, eff->ob_zdir);
     }
   }
 
@@ -814,9 +839,7 @@ static void get_effector_tot(
   efd->index = p;
 
   if (eff->pd->shape == PFIELD_SHAPE_POINTS) {
-    /* TODO: hair and points object support */
-    const Mesh *mesh_eval = BKE_object_get_evaluated_mesh(eff->ob);
-    *tot = mesh_eval != nullptr ? mesh_eval->verts_num : 1;
+    *tot = eff->points_positions != nullptr ? eff->points_num : 1;
 
     if (*tot && eff->pd->forcefield == PFIELD_HARMONIC && point->index >= 0) {
       *p = point->index % *tot;
@@ -16,6 +16,7 @@
 #include "BLI_alloca.h"
 #include "BLI_expr_pylike_eval.h"
 #include "BLI_listbase.h"
+#include "BLI_map.hh"
 #include "BLI_math_base_safe.h"
 #include "BLI_math_matrix.h"
 #include "BLI_math_rotation.h"
@@ -50,6 +51,7 @@
 #endif
 
 #include <cstring>
+#include <string>
 
 #ifdef WITH_PYTHON
 static ThreadMutex python_driver_lock = BLI_MUTEX_INITIALIZER;
@@ -161,6 +163,57 @@ static bool dtar_try_use_fallback(DriverTarget *dtar)
   return true;
 }
 
+/** A target RNA path and what it resolved to, when it was last evaluated. */
+struct DriverTargetPathCacheItem {
+  std::string rna_path;
+  /** The struct the path was resolved from. */
+  const StructRNA *type;
+  const void *data;
+  PropertyRNA *prop;
+  int index;
+};
+
+struct DriverTargetPathCache {
+  /** The key is the name of the variable, which is unique within a driver. */
+  blender::Map<std::string, DriverTargetPathCacheItem> items;
+};
+
+DriverTargetPathCache *driver_target_path_cache_new()
+{
+  return MEM_new<DriverTargetPathCache>(__func__);
+}
+
+void driver_target_path_cache_free(DriverTargetPathCache *cache)
+{
+  MEM_delete(cache);
+}
+
+/**
+ * Look up the property the target's path resolved to the last time it was evaluated from the
+ * same struct. The driver is only evaluated by one thread at a time, so this is not locked.
+ */
+static bool driver_target_path_cache_lookup(const DriverTargetPathCache *cache,
+                                            const DriverVar *dvar,
+                                            const DriverTarget *dtar,
+                                            const PointerRNA &property_ptr,
+                                            PropertyRNA **r_prop,
+                                            int *r_index)
+{
+  if (cache == nullptr || dtar->rna_path == nullptr) {
+    return false;
+  }
+  const DriverTargetPathCacheItem *item = cache->items.lookup_ptr_as(
+      blender::StringRef(dvar->name));
+  if (item == nullptr || item->type != property_ptr.type || item->data != property_ptr.data ||
+      item->rna_path != dtar->rna_path)
+  {
+    return false;
+  }
+  *r_prop = item->prop;
+  *r_index = item->index;
+  return true;
+}
+
 /**
  * Helper function to obtain a value using RNA from the specified source
  * (for evaluating drivers).
@@ -198,9 +251,26 @@ static float dtar_get_prop_val(const AnimationEvalContext *anim_eval_context,
   PropertyRNA *value_prop;
   int index = -1;
   float value = 0.0f;
-  if (!RNA_path_resolve_property_full(
-          &property_ptr, dtar->rna_path, &value_ptr, &value_prop, &index))
+  DriverTargetPathCache *path_cache = anim_eval_context->driver_path_cache;
+  if (driver_target_path_cache_lookup(path_cache, dvar, dtar, property_ptr, &value_prop, &index))
+  {
+    /* Path was resolved before from the same struct, skip parsing it again. */
+    value_ptr = property_ptr;
+  }
+  else if (RNA_path_resolve_property_full(
+               &property_ptr, dtar->rna_path, &value_ptr, &value_prop, &index))
   {
+    /* Only cache properties which are stored in the struct itself: data reached through pointers
+     * in the path (pose channels, modifiers, ID properties, ...) is re-allocated by the
+     * copy-on-evaluation update of its owner, which doesn't rebuild the relations. */
+    if (path_cache && value_ptr.data == property_ptr.data && !RNA_property_is_idprop(value_prop))
+    {
+      DriverTargetPathCacheItem item{
+          dtar->rna_path, property_ptr.type, property_ptr.data, value_prop, index};
+      path_cache->items.add_overwrite(dvar->name, std::move(item));
+    }
+  }
+  else {
     if (dtar_try_use_fallback(dtar)) {
       return dtar->fallback_value;
     }
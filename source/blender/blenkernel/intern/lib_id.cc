@@ -2236,11 +2236,15 @@ void BKE_libblock_rename(Main *bmain, ID *id, const char *name)
   if (STREQ(id->name + 2, name)) {
     return;
   }
+  /* Lock like when adding IDs to Main, so that renaming stays consistent with IDs that are
+   * created from other threads at the same time. */
+  BKE_main_lock(bmain);
   BKE_main_namemap_remove_name(bmain, id, id->name + 2);
   ListBase *lb = which_libbase(bmain, GS(id->name));
   if (BKE_id_new_name_validate(bmain, lb, id, name, true)) {
     bmain->is_memfile_undo_written = false;
   }
+  BKE_main_unlock(bmain);
 }
 
 void BKE_id_full_name_get(char name[MAX_ID_FULL_NAME], const ID *id, char separator_char)
@@ -219,6 +219,7 @@ void mesh_calc_edges(Mesh &mesh, bool keep_existing_edges, const bool select_new
   CustomData_reset(&mesh.edge_data);
   mesh.edges_num = edge_offsets.total_size();
   attributes.add<int2>(".edge_verts", AttrDomain::Edge, AttributeInitMoveArray(new_edges.data()));
+  mesh.tag_topology_changed();
 
   if (select_new_edges) {
     MutableAttributeAccessor attributes = mesh.attributes_for_write();
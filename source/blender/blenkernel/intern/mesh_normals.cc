@@ -19,6 +19,7 @@
 
 #include "BLI_array_utils.hh"
 #include "BLI_bit_vector.hh"
+#include "BLI_index_mask.hh"
 #include "BLI_linklist.h"
 #include "BLI_math_base.hh"
 #include "BLI_math_vector.hh"
@@ -145,47 +146,69 @@ float3 face_normal_calc(const Span<float3> vert_positions, const Span<int> face_
 void normals_calc_faces(const Span<float3> positions,
                         const OffsetIndices<int> faces,
                         const Span<int> corner_verts,
+                        const IndexMask &mask,
                         MutableSpan<float3> face_normals)
 {
   BLI_assert(faces.size() == face_normals.size());
-  threading::parallel_for(faces.index_range(), 1024, [&](const IndexRange range) {
-    for (const int i : range) {
-      face_normals[i] = normal_calc_ngon(positions, corner_verts.slice(faces[i]));
-    }
+  mask.foreach_index(GrainSize(1024), [&](const int i) {
+    face_normals[i] = normal_calc_ngon(positions, corner_verts.slice(faces[i]));
   });
 }
 
+void normals_calc_faces(const Span<float3> positions,
+                        const OffsetIndices<int> faces,
+                        const Span<int> corner_verts,
+                        MutableSpan<float3> face_normals)
+{
+  normals_calc_faces(positions, faces, corner_verts, faces.index_range(), face_normals);
+}
+
 void normals_calc_verts(const Span<float3> vert_positions,
                         const OffsetIndices<int> faces,
                         const Span<int> corner_verts,
                         const GroupedSpan<int> vert_to_face_map,
                         const Span<float3> face_normals,
+                        const IndexMask &mask,
                         MutableSpan<float3> vert_normals)
 {
   const Span<float3> positions = vert_positions;
-  threading::parallel_for(positions.index_range(), 1024, [&](const IndexRange range) {
-    for (const int vert : range) {
-      const Span<int> vert_faces = vert_to_face_map[vert];
-      if (vert_faces.is_empty()) {
-        vert_normals[vert] = math::normalize(positions[vert]);
-        continue;
-      }
-
-      float3 vert_normal(0);
-      for (const int face : vert_faces) {
-        const int2 adjacent_verts = face_find_adjacent_verts(faces[face], corner_verts, vert);
-        const float3 dir_prev = math::normalize(positions[adjacent_verts[0]] - positions[vert]);
-        const float3 dir_next = math::normalize(positions[adjacent_verts[1]] - positions[vert]);
-        const float factor = math::safe_acos_approx(math::dot(dir_prev, dir_next));
+  mask.foreach_index(GrainSize(1024), [&](const int vert) {
+    const Span<int> vert_faces = vert_to_face_map[vert];
+    if (vert_faces.is_empty()) {
+      vert_normals[vert] = math::normalize(positions[vert]);
+      return;
+    }
 
-        vert_normal += face_normals[face] * factor;
-      }
+    float3 vert_normal(0);
+    for (const int face : vert_faces) {
+      const int2 adjacent_verts = face_find_adjacent_verts(faces[face], corner_verts, vert);
+      const float3 dir_prev = math::normalize(positions[adjacent_verts[0]] - positions[vert]);
+      const float3 dir_next = math::normalize(positions[adjacent_verts[1]] - positions[vert]);
+      const float factor = math::safe_acos_approx(math::dot(dir_prev, dir_next));
 
-      vert_normals[vert] = math::normalize(vert_normal);
+      vert_normal += face_normals[face] * factor;
     }
+
+    vert_normals[vert] = math::normalize(vert_normal);
   });
 }
 
+void normals_calc_verts(const Span<float3> vert_positions,
+                        const OffsetIndices<int> faces,
+                        const Span<int> corner_verts,
+                        const GroupedSpan<int> vert_to_face_map,
+                        const Span<float3> face_normals,
+                        MutableSpan<float3> vert_normals)
+{
+  normals_calc_verts(vert_positions,
+                     faces,
+                     corner_verts,
+                     vert_to_face_map,
+                     face_normals,
+                     vert_positions.index_range(),
+                     vert_normals);
+}
+
 /** \} */
 
 }  // namespace blender::bke::mesh
@@ -1020,71 +1043,88 @@ static void split_corner_normal_fan_do(CornerSplitTaskDataCommon *common_data,
 }
 
 /**
- * Check whether given corner is part of an unknown-so-far cyclic smooth fan, or not.
+ * Find the entry points of cyclic smooth fans.
  * Needed because cyclic smooth fans have no obvious 'entry point',
- * and yet we need to walk them once, and only once.
+ * and yet we need to walk them once, and only once. The corner with the lowest index in the fan
+ * is used. Fans are walked per vertex, so every corner is visited only once, even around vertices
+ * with a high valence.
  */
-static bool corner_split_generator_check_cyclic_smooth_fan(const Span<int> corner_verts,
-                                                           const Span<int> corner_edges,
-                                                           const OffsetIndices<int> faces,
-                                                           const Span<int2> edge_to_corners,
-                                                           const Span<int> corner_to_face,
-                                                           const int2 e2l_prev,
-                                                           MutableBitSpan skip_corners,
-                                                           const int corner,
-                                                           const int corner_prev)
+static Array<bool> find_cyclic_smooth_fan_starts(const CornerSplitTaskDataCommon &common_data)
 {
-  /* The vertex we are "fanning" around. */
-  const int vert_pivot = corner_verts[corner];
-
-  int2 e2lfan_curr = e2l_prev;
-  if (IS_EDGE_SHARP(e2lfan_curr)) {
-    /* Sharp corner, so not a cyclic smooth fan. */
-    return false;
-  }
-
-  /* `vert_corner` the corner of our current edge might not be the corner of our current
-   * vertex!
-   */
-  int fan_corner = corner_prev;
-  int vert_corner = corner;
-
-  BLI_assert(fan_corner >= 0);
-  BLI_assert(vert_corner >= 0);
-
-  BLI_assert(!skip_corners[vert_corner]);
-  skip_corners[vert_corner].set();
-
-  while (true) {
-    /* Find next corner of the smooth fan. */
-    corner_manifold_fan_around_vert_next(
-        corner_verts, faces, corner_to_face, e2lfan_curr, vert_pivot, &fan_corner, &vert_corner);
+  const Span<int> corner_verts = common_data.corner_verts;
+  const Span<int> corner_edges = common_data.corner_edges;
+  const OffsetIndices faces = common_data.faces;
+  const Span<int> corner_to_face = common_data.corner_to_face;
+  const Span<int2> edge_to_corners = common_data.edge_to_corners;
+
+  Array<int> vert_to_corner_offsets;
+  Array<int> vert_to_corner_indices;
+  const GroupedSpan<int> vert_to_corner_map = build_vert_to_corner_map(
+      corner_verts, common_data.positions.size(), vert_to_corner_offsets, vert_to_corner_indices);
+
+  Array<bool> fan_starts(corner_verts.size(), false);
+  /* A fan only contains corners of its pivot vertex, so tasks never access the same elements. */
+  Array<bool> visited_corners(corner_verts.size(), false);
+
+  threading::parallel_for(vert_to_corner_map.index_range(), 1024, [&](const IndexRange range) {
+    for (const int vert_pivot : range) {
+      /* Corners are sorted, so the first corner of a fan that is reached is its lowest one. */
+      for (const int corner : vert_to_corner_map[vert_pivot]) {
+        if (visited_corners[corner]) {
+          continue;
+        }
+        visited_corners[corner] = true;
 
-    e2lfan_curr = edge_to_corners[corner_edges[fan_corner]];
+        if (IS_EDGE_SHARP(edge_to_corners[corner_edges[corner]])) {
+          continue;
+        }
+        const int corner_prev = mesh::face_corner_prev(faces[corner_to_face[corner]], corner);
+        int2 e2lfan_curr = edge_to_corners[corner_edges[corner_prev]];
+        if (IS_EDGE_SHARP(e2lfan_curr)) {
+          /* Sharp corner, so not a cyclic smooth fan. */
+          continue;
+        }
 
-    if (IS_EDGE_SHARP(e2lfan_curr)) {
-      /* Sharp corner/edge, so not a cyclic smooth fan. */
-      return false;
-    }
-    /* Smooth corner/edge. */
-    if (skip_corners[vert_corner]) {
-      if (vert_corner == corner) {
-        /* We walked around a whole cyclic smooth fan without finding any already-processed corner,
-         * means we can use initial current / previous edge as start for this smooth fan. */
-        return true;
+        /* `vert_corner` the corner of our current edge might not be the corner of our current
+         * vertex!
+         */
+        int fan_corner = corner_prev;
+        int vert_corner = corner;
+        while (true) {
+          /* Find next corner of the smooth fan. */
+          corner_manifold_fan_around_vert_next(corner_verts,
+                                               faces,
+                                               corner_to_face,
+                                               e2lfan_curr,
+                                               vert_pivot,
+                                               &fan_corner,
+                                               &vert_corner);
+
+          e2lfan_curr = edge_to_corners[corner_edges[fan_corner]];
+
+          if (IS_EDGE_SHARP(e2lfan_curr)) {
+            /* Sharp corner/edge, so not a cyclic smooth fan. */
+            break;
+          }
+          /* Smooth corner/edge. */
+          if (visited_corners[vert_corner]) {
+            /* We walked around a whole cyclic smooth fan when we are back to the initial corner,
+             * means we can use initial current / previous edge as start for this smooth fan. */
+            fan_starts[corner] = vert_corner == corner;
+            break;
+          }
+          visited_corners[vert_corner] = true;
+        }
       }
-      /* Already checked in some previous looping, we can abort. */
-      return false;
     }
+  });
 
-    /* We can skip it in future, and keep checking the smooth fan. */
-    skip_corners[vert_corner].set();
-  }
+  return fan_starts;
 }
 
 static void corner_split_generator(CornerSplitTaskDataCommon *common_data,
-                                   Vector<int, 32> &r_single_corners,
-                                   Vector<int, 32> &r_fan_corners)
+                                   Array<int> &r_single_corners,
+                                   Array<int> &r_fan_corners)
 {
   const Span<int> corner_verts = common_data->corner_verts;
   const Span<int> corner_edges = common_data->corner_edges;
@@ -1092,63 +1132,31 @@ static void corner_split_generator(CornerSplitTaskDataCommon *common_data,
   const Span<int> corner_to_face = common_data->corner_to_face;
   const Span<int2> edge_to_corners = common_data->edge_to_corners;
 
-  BitVector<> skip_corners(corner_verts.size(), false);
-
 #ifdef DEBUG_TIME
   SCOPED_TIMER_AVERAGED(__func__);
 #endif
 
   /* We now know edges that can be smoothed (with their vector, and their two corners),
    * and edges that will be hard! Now, time to generate the normals.
-   */
-  for (const int face_index : faces.index_range()) {
-    const IndexRange face = faces[face_index];
-
-    for (const int corner : face) {
-      const int corner_prev = mesh::face_corner_prev(face, corner);
-
-#if 0
-      printf("Checking corner %d / edge %u / vert %u (sharp edge: %d, skiploop: %d)",
-             corner,
-             corner_edges[corner],
-             corner_verts[corner],
-             IS_EDGE_SHARP(edge_to_corners[corner_edges[corner]]),
-             skip_corners[corner]);
-#endif
-
-      /* A smooth edge, we have to check for cyclic smooth fan case.
-       * If we find a new, never-processed cyclic smooth fan, we can do it now using that
-       * corner/edge as 'entry point', otherwise we can skip it. */
-
-      /* NOTE: In theory, we could make #corner_split_generator_check_cyclic_smooth_fan() store
-       * vert_corner'es and edge indexes in two stacks, to avoid having to fan again around
-       * the vert during actual computation of `clnor` & `clnorspace`.
-       * However, this would complicate the code, add more memory usage, and despite its logical
-       * complexity, #corner_manifold_fan_around_vert_next() is quite cheap in term of CPU cycles,
-       * so really think it's not worth it. */
-      if (!IS_EDGE_SHARP(edge_to_corners[corner_edges[corner]]) &&
-          (skip_corners[corner] || !corner_split_generator_check_cyclic_smooth_fan(
-                                       corner_verts,
-                                       corner_edges,
-                                       faces,
-                                       edge_to_corners,
-                                       corner_to_face,
-                                       edge_to_corners[corner_edges[corner_prev]],
-                                       skip_corners,
-                                       corner,
-                                       corner_prev)))
-      {
-        // printf("SKIPPING!\n");
-      }
-      else {
-        if (IS_EDGE_SHARP(edge_to_corners[corner_edges[corner]]) &&
-            IS_EDGE_SHARP(edge_to_corners[corner_edges[corner_prev]]))
-        {
-          /* Simple case (both edges around that vertex are sharp in current face),
-           * this corner just takes its face normal. */
-          r_single_corners.append(corner);
-        }
-        else {
+   *
+   * Every corner is classified independently, so this can run in parallel. The resulting corners
+   * are sorted by index, so the order (and therefore the space indices) is deterministic. */
+  const Array<bool> cyclic_fan_starts = find_cyclic_smooth_fan_starts(*common_data);
+
+  IndexMaskMemory memory;
+  const IndexMask single_corners = IndexMask::from_predicate(
+      corner_verts.index_range(), GrainSize(4096), memory, [&](const int corner) {
+        const int corner_prev = mesh::face_corner_prev(faces[corner_to_face[corner]], corner);
+        /* Simple case (both edges around that vertex are sharp in current face),
+         * this corner just takes its face normal. */
+        return IS_EDGE_SHARP(edge_to_corners[corner_edges[corner]]) &&
+               IS_EDGE_SHARP(edge_to_corners[corner_edges[corner_prev]]);
+      });
+  const IndexMask fan_corners = IndexMask::from_predicate(
+      corner_verts.index_range(), GrainSize(4096), memory, [&](const int corner) {
+        const int corner_prev = mesh::face_corner_prev(faces[corner_to_face[corner]], corner);
+        const int2 e2l_prev = edge_to_corners[corner_edges[corner_prev]];
+        if (IS_EDGE_SHARP(edge_to_corners[corner_edges[corner]])) {
           /* We do not need to check/tag corners as already computed. Due to the fact that a corner
            * only points to one of its two edges, the same fan will never be walked more than once.
            * Since we consider edges that have neighbor faces with inverted (flipped) normals as
@@ -1156,11 +1164,18 @@ static void corner_split_generator(CornerSplitTaskDataCommon *common_data,
            * current edge, smooth previous edge), and not the alternative (smooth current edge,
            * sharp previous edge). All this due/thanks to the link between normals and corner
            * ordering (i.e. winding). */
-          r_fan_corners.append(corner);
+          return !IS_EDGE_SHARP(e2l_prev);
         }
-      }
-    }
-  }
+        /* A smooth edge, we have to check for cyclic smooth fan case.
+         * If this corner is the entry point of a cyclic smooth fan, we can do it now using that
+         * corner/edge, otherwise we can skip it. */
+        return cyclic_fan_starts[corner];
+      });
+
+  r_single_corners.reinitialize(single_corners.size());
+  single_corners.to_indices<int>(r_single_corners);
+  r_fan_corners.reinitialize(fan_corners.size());
+  fan_corners.to_indices<int>(r_fan_corners);
 }
 
 void normals_calc_corners(const Span<float3> vert_positions,
@@ -1227,8 +1242,8 @@ void normals_calc_corners(const Span<float3> vert_positions,
   build_edge_to_corner_map_with_flip_and_sharp(
       faces, corner_verts, corner_edges, sharp_faces, sharp_edges, edge_to_corners);
 
-  Vector<int, 32> single_corners;
-  Vector<int, 32> fan_corners;
+  Array<int> single_corners;
+  Array<int> fan_corners;
   corner_split_generator(&common_data, single_corners, fan_corners);
 
   if (r_lnors_spacearr) {
@@ -25,6 +25,7 @@
 #include "BLI_memarena.h"
 #include "BLI_polyfill_2d.h"
 #include "BLI_rand.h"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
 
 #include "BKE_bvhutils.hh"
@@ -446,6 +447,55 @@ struct IslandResult {
 /* Will be enough in 99% of cases. */
 #define MREMAP_DEFAULT_BUFSIZE 32
 
+/* Number of destination items handled by a single task when querying the BVH-tree in parallel. */
+#define MREMAP_PARALLEL_GRAIN_SIZE 1024
+/* Same for destination faces, which are queried against every source island. */
+#define MREMAP_PARALLEL_FACES_GRAIN_SIZE 64
+/* Maximum number of dest faces multiplied by the number of source islands to query at once. */
+#define MREMAP_LOOPS_BATCH_SIZE (1 << 16)
+
+/**
+ * Find the nearest source element for each destination vertex, in parallel.
+ *
+ * Every vertex starts its search from scratch rather than from the previous hit, so that ties
+ * are resolved the same way regardless of how the range is split between tasks.
+ * Results are stored per destination vertex, with an index of -1 when nothing was found
+ * within \a max_dist_sq. Remap items are defined afterwards by the caller, since their
+ * allocation from the map's memory arena is not thread-safe.
+ */
+static void mesh_remap_bvhtree_query_nearest_verts(BVHTreeFromMesh *treedata,
+                                                   const SpaceTransform *space_transform,
+                                                   const float (*vert_positions_dst)[3],
+                                                   const float max_dist_sq,
+                                                   blender::MutableSpan<int> r_indices,
+                                                   blender::MutableSpan<float> r_hit_dists)
+{
+  blender::threading::parallel_for(
+      r_indices.index_range(), MREMAP_PARALLEL_GRAIN_SIZE, [&](const blender::IndexRange range) {
+        BVHTreeNearest nearest = {0};
+        for (const int64_t i : range) {
+          nearest.index = -1;
+
+          float tmp_co[3];
+          copy_v3_v3(tmp_co, vert_positions_dst[i]);
+
+          /* Convert the vertex to tree coordinates, if needed. */
+          if (space_transform) {
+            BLI_space_transform_apply(space_transform, tmp_co);
+          }
+
+          if (mesh_remap_bvhtree_query_nearest(
+                  treedata, &nearest, tmp_co, max_dist_sq, &r_hit_dists[i]))
+          {
+            r_indices[i] = nearest.index;
+          }
+          else {
+            r_indices[i] = -1;
+          }
+        }
+      });
+}
+
 void BKE_mesh_remap_calc_verts_from_mesh(const int mode,
                                          const SpaceTransform *space_transform,
                                          const float max_dist,
@@ -479,19 +529,15 @@ void BKE_mesh_remap_calc_verts_from_mesh(const int mode,
 
     if (mode == MREMAP_MODE_VERT_NEAREST) {
       BKE_bvhtree_from_mesh_get(&treedata, me_src, BVHTREE_FROM_VERTS, 2);
-      nearest.index = -1;
 
-      for (i = 0; i < numverts_dst; i++) {
-        copy_v3_v3(tmp_co, vert_positions_dst[i]);
-
-        /* Convert the vertex to tree coordinates, if needed. */
-        if (space_transform) {
-          BLI_space_transform_apply(space_transform, tmp_co);
-        }
+      blender::Array<int> nearest_indices(numverts_dst);
+      blender::Array<float> hit_dists(numverts_dst);
+      mesh_remap_bvhtree_query_nearest_verts(
+          &treedata, space_transform, vert_positions_dst, max_dist_sq, nearest_indices, hit_dists);
 
-        if (mesh_remap_bvhtree_query_nearest(&treedata, &nearest, tmp_co, max_dist_sq, &hit_dist))
-        {
-          mesh_remap_item_define(r_map, i, hit_dist, 0, 1, &nearest.index, &full_weight);
+      for (i = 0; i < numverts_dst; i++) {
+        if (nearest_indices[i] != -1) {
+          mesh_remap_item_define(r_map, i, hit_dists[i], 0, 1, &nearest_indices[i], &full_weight);
         }
         else {
           /* No source for this dest vertex! */
@@ -504,19 +550,23 @@ void BKE_mesh_remap_calc_verts_from_mesh(const int mode,
       const blender::Span<blender::float3> positions_src = me_src->vert_positions();
 
       BKE_bvhtree_from_mesh_get(&treedata, me_src, BVHTREE_FROM_EDGES, 2);
-      nearest.index = -1;
+
+      blender::Array<int> nearest_indices(numverts_dst);
+      blender::Array<float> hit_dists(numverts_dst);
+      mesh_remap_bvhtree_query_nearest_verts(
+          &treedata, space_transform, vert_positions_dst, max_dist_sq, nearest_indices, hit_dists);
 
       for (i = 0; i < numverts_dst; i++) {
-        copy_v3_v3(tmp_co, vert_positions_dst[i]);
+        if (nearest_indices[i] != -1) {
+          const blender::int2 &edge = edges_src[nearest_indices[i]];
 
-        /* Convert the vertex to tree coordinates, if needed. */
-        if (space_transform) {
-          BLI_space_transform_apply(space_transform, tmp_co);
-        }
+          copy_v3_v3(tmp_co, vert_positions_dst[i]);
+
+          /* Convert the vertex to tree coordinates, if needed. */
+          if (space_transform) {
+            BLI_space_transform_apply(space_transform, tmp_co);
+          }
 
-        if (mesh_remap_bvhtree_query_nearest(&treedata, &nearest, tmp_co, max_dist_sq, &hit_dist))
-        {
-          const blender::int2 &edge = edges_src[nearest.index];
           const float *v1cos = positions_src[edge[0]];
           const float *v2cos = positions_src[edge[1]];
 
@@ -524,7 +574,7 @@ void BKE_mesh_remap_calc_verts_from_mesh(const int mode,
             const float dist_v1 = len_squared_v3v3(tmp_co, v1cos);
             const float dist_v2 = len_squared_v3v3(tmp_co, v2cos);
             const int index = (dist_v1 > dist_v2) ? edge[1] : edge[0];
-            mesh_remap_item_define(r_map, i, hit_dist, 0, 1, &index, &full_weight);
+            mesh_remap_item_define(r_map, i, hit_dists[i], 0, 1, &index, &full_weight);
           }
           else if (mode == MREMAP_MODE_VERT_EDGEINTERP_NEAREST) {
             int indices[2];
@@ -538,7 +588,7 @@ void BKE_mesh_remap_calc_verts_from_mesh(const int mode,
             CLAMP(weights[0], 0.0f, 1.0f);
             weights[1] = 1.0f - weights[0];
 
-            mesh_remap_item_define(r_map, i, hit_dist, 0, 2, indices, weights);
+            mesh_remap_item_define(r_map, i, hit_dists[i], 0, 2, indices, weights);
           }
         }
         else {
@@ -1240,11 +1290,7 @@ void BKE_mesh_remap_calc_loops_from_mesh(const int mode,
   }
   else {
     BVHTreeFromMesh *treedata = nullptr;
-    BVHTreeNearest nearest = {0};
-    BVHTreeRayHit rayhit = {0};
     int num_trees = 0;
-    float hit_dist;
-    float tmp_co[3], tmp_no[3];
 
     const bool use_from_vert = (mode & MREMAP_USE_VERT);
 
@@ -1293,11 +1339,6 @@ void BKE_mesh_remap_calc_loops_from_mesh(const int mode,
     int *indices_interp = nullptr;
     float *weights_interp = nullptr;
 
-    int tindex, pidx_dst, lidx_dst, plidx_dst, pidx_src, lidx_src, plidx_src;
-
-    IslandResult **islands_res;
-    size_t islands_res_buff_size = MREMAP_DEFAULT_BUFSIZE;
-
     if (!use_from_vert) {
       vcos_interp = static_cast<float(*)[3]>(
           MEM_mallocN(sizeof(*vcos_interp) * buff_size_interp, __func__));
@@ -1400,7 +1441,7 @@ void BKE_mesh_remap_calc_loops_from_mesh(const int mode,
 
     /* Build our AStar graphs. */
     if (isld_steps_src) {
-      for (tindex = 0; tindex < num_trees; tindex++) {
+      for (int tindex = 0; tindex < num_trees; tindex++) {
         mesh_island_to_astar_graph(use_islands ? &island_store : nullptr,
                                    tindex,
                                    positions_src,
@@ -1418,7 +1459,7 @@ void BKE_mesh_remap_calc_loops_from_mesh(const int mode,
       if (use_islands) {
         blender::BitVector<> verts_active(num_verts_src);
 
-        for (tindex = 0; tindex < num_trees; tindex++) {
+        for (int tindex = 0; tindex < num_trees; tindex++) {
           MeshElemMap *isld = island_store.islands[tindex];
           int num_verts_active = 0;
           verts_active.fill(false);
@@ -1445,7 +1486,7 @@ void BKE_mesh_remap_calc_loops_from_mesh(const int mode,
         tri_faces_src = me_src->corner_tri_faces();
         blender::BitVector<> corner_tris_active(corner_tris_src.size());
 
-        for (tindex = 0; tindex < num_trees; tindex++) {
+        for (int tindex = 0; tindex < num_trees; tindex++) {
           int corner_tris_num_active = 0;
           corner_tris_active.fill(false);
           for (const int64_t i : corner_tris_src.index_range()) {
@@ -1473,15 +1514,17 @@ void BKE_mesh_remap_calc_loops_from_mesh(const int mode,
     }
 
     /* And check each dest face! */
-    islands_res = static_cast<IslandResult **>(
-        MEM_mallocN(sizeof(*islands_res) * size_t(num_trees), __func__));
-    for (tindex = 0; tindex < num_trees; tindex++) {
-      islands_res[tindex] = static_cast<IslandResult *>(
-          MEM_mallocN(sizeof(**islands_res) * islands_res_buff_size, __func__));
-    }
     const blender::Span<int> tri_faces = me_src->corner_tri_faces();
 
-    for (pidx_dst = 0; pidx_dst < faces_dst.size(); pidx_dst++) {
+    /* Query all trees for every corner of a dest face, storing the results in \a islands_res. */
+    const auto query_face_dst = [&](const int pidx_dst, const Span<IslandResult *> islands_res) {
+      /* All query data is local, so that faces can be queried in parallel. */
+      BVHTreeNearest nearest = {0};
+      BVHTreeRayHit rayhit = {0};
+      float hit_dist;
+      float tmp_co[3], tmp_no[3];
+      int tindex, plidx_dst, pidx_src, lidx_src, plidx_src;
+
       const blender::IndexRange face_dst = faces_dst[pidx_dst];
       float pnor_dst[3];
 
@@ -1497,14 +1540,6 @@ void BKE_mesh_remap_calc_loops_from_mesh(const int mode,
         }
       }
 
-      if (size_t(face_dst.size()) > islands_res_buff_size) {
-        islands_res_buff_size = size_t(face_dst.size()) + MREMAP_DEFAULT_BUFSIZE;
-        for (tindex = 0; tindex < num_trees; tindex++) {
-          islands_res[tindex] = static_cast<IslandResult *>(
-              MEM_reallocN(islands_res[tindex], sizeof(**islands_res) * islands_res_buff_size));
-        }
-      }
-
       for (tindex = 0; tindex < num_trees; tindex++) {
         BVHTreeFromMesh *tdata = &treedata[tindex];
 
@@ -1700,6 +1735,14 @@ void BKE_mesh_remap_calc_loops_from_mesh(const int mode,
           }
         }
       }
+    };
+
+    /* Choose the best island of a dest face from \a islands_res, and define its remap items. */
+    const auto define_face_dst_items = [&](const int pidx_dst,
+                                           const Span<IslandResult *> islands_res) {
+      const blender::IndexRange face_dst = faces_dst[pidx_dst];
+      float tmp_co[3];
+      int tindex, lidx_dst, plidx_dst, pidx_src, lidx_src;
 
       /* And now, find best island to use! */
       /* We have to first select the 'best source island' for given dst face and its loops.
@@ -1995,16 +2038,55 @@ void BKE_mesh_remap_calc_loops_from_mesh(const int mode,
 
         BLI_astar_solution_clear(&as_solution);
       }
+    };
+
+    /* The queries of different dest faces are independent, so they are done in parallel for
+     * batches of faces. Remap items are then defined serially, since they are allocated from the
+     * map's memory arena, which is not thread-safe. Batches limit the memory used to store the
+     * query results, which are needed for every island. */
+    const int64_t faces_batch_size = std::max<int64_t>(MREMAP_LOOPS_BATCH_SIZE / num_trees, 1);
+    Array<IslandResult> batch_res;
+
+    for (int64_t batch_start = 0; batch_start < faces_dst.size(); batch_start += faces_batch_size)
+    {
+      const IndexRange faces_batch = IndexRange::from_begin_end(
+          batch_start, std::min<int64_t>(batch_start + faces_batch_size, faces_dst.size()));
+      const int64_t batch_corners_start = faces_dst[faces_batch.first()].start();
+      const int64_t batch_corners_num = faces_dst[faces_batch.last()].one_after_last() -
+                                        batch_corners_start;
+      batch_res.reinitialize(num_trees * batch_corners_num);
+
+      /* Results of every tree for the corners of a dest face. */
+      const auto face_islands_res_get = [&](const int pidx_dst,
+                                            MutableSpan<IslandResult *> r_islands_res) {
+        const int64_t face_offset = faces_dst[pidx_dst].start() - batch_corners_start;
+        for (const int64_t i : r_islands_res.index_range()) {
+          r_islands_res[i] = &batch_res[i * batch_corners_num + face_offset];
+        }
+      };
+
+      threading::parallel_for(
+          faces_batch, MREMAP_PARALLEL_FACES_GRAIN_SIZE, [&](const IndexRange range) {
+            Array<IslandResult *, 16> islands_res(num_trees);
+            for (const int64_t pidx_dst : range) {
+              face_islands_res_get(int(pidx_dst), islands_res);
+              query_face_dst(int(pidx_dst), islands_res);
+            }
+          });
+
+      Array<IslandResult *, 16> islands_res(num_trees);
+      for (const int64_t pidx_dst : faces_batch) {
+        face_islands_res_get(int(pidx_dst), islands_res);
+        define_face_dst_items(int(pidx_dst), islands_res);
+      }
     }
 
-    for (tindex = 0; tindex < num_trees; tindex++) {
-      MEM_freeN(islands_res[tindex]);
+    for (int tindex = 0; tindex < num_trees; tindex++) {
       free_bvhtree_from_mesh(&treedata[tindex]);
       if (isld_steps_src) {
         BLI_astar_graph_free(&as_graphdata[tindex]);
       }
     }
-    MEM_freeN(islands_res);
     BKE_mesh_loop_islands_free(&island_store);
     MEM_freeN(treedata);
     if (isld_steps_src) {
@@ -162,6 +162,28 @@ blender::GroupedSpan<int> Mesh::vert_to_corner_map() const
   return {offsets, this->runtime->vert_to_corner_map_cache.data()};
 }
 
+blender::GroupedSpan<int> Mesh::vert_to_edge_map() const
+{
+  using namespace blender;
+  this->runtime->vert_to_edge_map_cache.ensure([&](bke::GroupedIndicesCache &r_data) {
+    bke::mesh::build_vert_to_edge_map(
+        this->edges(), this->verts_num, r_data.offsets, r_data.indices);
+  });
+  const bke::GroupedIndicesCache &data = this->runtime->vert_to_edge_map_cache.data();
+  return {OffsetIndices<int>(data.offsets), data.indices};
+}
+
+blender::GroupedSpan<int> Mesh::edge_to_face_map() const
+{
+  using namespace blender;
+  this->runtime->edge_to_face_map_cache.ensure([&](bke::GroupedIndicesCache &r_data) {
+    bke::mesh::build_edge_to_face_map(
+        this->faces(), this->corner_edges(), this->edges_num, r_data.offsets, r_data.indices);
+  });
+  const bke::GroupedIndicesCache &data = this->runtime->edge_to_face_map_cache.data();
+  return {OffsetIndices<int>(data.offsets), data.indices};
+}
+
 const blender::bke::LooseVertCache &Mesh::loose_verts() const
 {
   using namespace blender::bke;
@@ -319,6 +341,8 @@ void BKE_mesh_runtime_clear_geometry(Mesh *mesh)
   mesh->runtime->vert_to_face_map_cache.tag_dirty();
   mesh->runtime->vert_to_corner_map_cache.tag_dirty();
   mesh->runtime->corner_to_face_map_cache.tag_dirty();
+  mesh->runtime->vert_to_edge_map_cache.tag_dirty();
+  mesh->runtime->edge_to_face_map_cache.tag_dirty();
   mesh->runtime->vert_normals_cache.tag_dirty();
   mesh->runtime->face_normals_cache.tag_dirty();
   mesh->runtime->corner_normals_cache.tag_dirty();
@@ -342,6 +366,8 @@ void Mesh::tag_edges_split()
   this->runtime->vert_to_face_offset_cache.tag_dirty();
   this->runtime->vert_to_face_map_cache.tag_dirty();
   this->runtime->vert_to_corner_map_cache.tag_dirty();
+  this->runtime->vert_to_edge_map_cache.tag_dirty();
+  this->runtime->edge_to_face_map_cache.tag_dirty();
   if (this->runtime->loose_edges_cache.is_cached() &&
       this->runtime->loose_edges_cache.data().count != 0)
   {
@@ -398,6 +424,64 @@ void Mesh::tag_positions_changed_no_normals()
   this->runtime->shrinkwrap_boundary_cache.tag_dirty();
 }
 
+void Mesh::tag_positions_changed_partial(const blender::IndexMask &changed_verts)
+{
+  using namespace blender;
+  bke::MeshRuntime &mesh_runtime = *this->runtime;
+  if (!mesh_runtime.face_normals_cache.is_cached()) {
+    /* Without cached face normals there is nothing to update incrementally. */
+    this->tag_positions_changed();
+    return;
+  }
+
+  Array<bool> verts_changed(this->verts_num, false);
+  changed_verts.to_bools(verts_changed);
+
+  const Span<float3> positions = this->vert_positions();
+  const OffsetIndices faces = this->faces();
+  const Span<int> corner_verts = this->corner_verts();
+
+  IndexMaskMemory memory;
+  const IndexMask affected_faces = IndexMask::from_predicate(
+      faces.index_range(), GrainSize(4096), memory, [&](const int face) {
+        const Span<int> face_verts = corner_verts.slice(faces[face]);
+        return std::any_of(face_verts.begin(), face_verts.end(), [&](const int vert) {
+          return verts_changed[vert];
+        });
+      });
+  mesh_runtime.face_normals_cache.update([&](Vector<float3> &r_data) {
+    bke::mesh::normals_calc_faces(positions, faces, corner_verts, affected_faces, r_data);
+  });
+
+  if (mesh_runtime.vert_normals_cache.is_cached()) {
+    /* Vertex normals depend on the positions of all neighbors in the adjacent faces. */
+    Array<bool> faces_affected(faces.size(), false);
+    affected_faces.to_bools(faces_affected);
+    const GroupedSpan<int> vert_to_face = this->vert_to_face_map();
+    const IndexMask affected_verts = IndexMask::from_predicate(
+        positions.index_range(), GrainSize(4096), memory, [&](const int vert) {
+          if (verts_changed[vert]) {
+            return true;
+          }
+          const Span<int> vert_faces = vert_to_face[vert];
+          return std::any_of(vert_faces.begin(), vert_faces.end(), [&](const int face) {
+            return faces_affected[face];
+          });
+        });
+    const Span<float3> face_normals = mesh_runtime.face_normals_cache.data();
+    mesh_runtime.vert_normals_cache.update([&](Vector<float3> &r_data) {
+      bke::mesh::normals_calc_verts(
+          positions, faces, corner_verts, vert_to_face, face_normals, affected_verts, r_data);
+    });
+  }
+  else {
+    mesh_runtime.vert_normals_cache.tag_dirty();
+  }
+
+  mesh_runtime.corner_normals_cache.tag_dirty();
+  this->tag_positions_changed_no_normals();
+}
+
 void Mesh::tag_positions_changed_uniformly()
 {
   /* The normals and triangulation didn't change, since all verts moved by the same amount. */
@@ -0,0 +1,123 @@
+/* SPDX-FileCopyrightText: 2024 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+#include "testing/testing.h"
+
+#include "BLI_index_mask.hh"
+#include "BLI_math_vector_types.hh"
+#include "BLI_span.hh"
+
+#include "BKE_idtype.hh"
+#include "BKE_lib_id.hh"
+#include "BKE_mesh.h"
+#include "BKE_mesh.hh"
+
+#include "DNA_mesh_types.h"
+
+namespace blender::bke::tests {
+
+class MeshRuntimeTest : public testing::Test {
+ public:
+  static void SetUpTestSuite()
+  {
+    BKE_idtype_init();
+  }
+};
+
+/** A grid of quads with varying heights, so that the normals differ for every face. */
+static Mesh *create_bumpy_grid(const int size)
+{
+  const int faces_num = (size - 1) * (size - 1);
+  Mesh *mesh = BKE_mesh_new_nomain(size * size, 0, faces_num, faces_num * 4);
+
+  MutableSpan<float3> positions = mesh->vert_positions_for_write();
+  for (const int y : IndexRange(size)) {
+    for (const int x : IndexRange(size)) {
+      positions[y * size + x] = float3(x, y, float((x * 7 + y * 3) % 5) * 0.1f);
+    }
+  }
+
+  MutableSpan<int> face_offsets = mesh->face_offsets_for_write();
+  MutableSpan<int> corner_verts = mesh->corner_verts_for_write();
+  for (const int y : IndexRange(size - 1)) {
+    for (const int x : IndexRange(size - 1)) {
+      const int face = y * (size - 1) + x;
+      const int vert = y * size + x;
+      face_offsets[face] = face * 4;
+      corner_verts.slice(face * 4, 4).copy_from({vert, vert + 1, vert + size + 1, vert + size});
+    }
+  }
+  face_offsets.last() = faces_num * 4;
+
+  mesh_calc_edges(*mesh, false, false);
+  return mesh;
+}
+
+static void move_verts(Mesh &mesh, const Span<int> verts)
+{
+  MutableSpan<float3> positions = mesh.vert_positions_for_write();
+  for (const int vert : verts) {
+    positions[vert] += float3(0.1f, -0.2f, 0.5f);
+  }
+}
+
+static void expect_normals_equal(const Span<float3> a, const Span<float3> b)
+{
+  ASSERT_EQ(a.size(), b.size());
+  for (const int64_t i : a.index_range()) {
+    EXPECT_NEAR(a[i].x, b[i].x, 1e-6f) << "Index " << i;
+    EXPECT_NEAR(a[i].y, b[i].y, 1e-6f) << "Index " << i;
+    EXPECT_NEAR(a[i].z, b[i].z, 1e-6f) << "Index " << i;
+  }
+}
+
+TEST_F(MeshRuntimeTest, tag_positions_changed_partial)
+{
+  Mesh *mesh_partial = create_bumpy_grid(8);
+  Mesh *mesh_full = create_bumpy_grid(8);
+
+  /* Make sure the normals are cached, so that they are updated incrementally. */
+  mesh_partial->face_normals();
+  mesh_partial->vert_normals();
+  mesh_partial->corner_normals();
+
+  const Array<int> moved_verts = {0, 9, 10, 27, 63};
+  move_verts(*mesh_partial, moved_verts);
+  move_verts(*mesh_full, moved_verts);
+
+  IndexMaskMemory memory;
+  mesh_partial->tag_positions_changed_partial(
+      IndexMask::from_indices(moved_verts.as_span(), memory));
+  mesh_full->tag_positions_changed();
+
+  expect_normals_equal(mesh_partial->face_normals(), mesh_full->face_normals());
+  expect_normals_equal(mesh_partial->vert_normals(), mesh_full->vert_normals());
+  expect_normals_equal(mesh_partial->corner_normals(), mesh_full->corner_normals());
+
+  BKE_id_free(nullptr, mesh_partial);
+  BKE_id_free(nullptr, mesh_full);
+}
+
+TEST_F(MeshRuntimeTest, tag_positions_changed_partial_without_cache)
+{
+  Mesh *mesh_partial = create_bumpy_grid(4);
+  Mesh *mesh_full = create_bumpy_grid(4);
+
+  const Array<int> moved_verts = {5};
+  move_verts(*mesh_partial, moved_verts);
+  move_verts(*mesh_full, moved_verts);
+
+  IndexMaskMemory memory;
+  mesh_partial->tag_positions_changed_partial(
+      IndexMask::from_indices(moved_verts.as_span(), memory));
+  mesh_full->tag_positions_changed();
+
+  expect_normals_equal(mesh_partial->face_normals(), mesh_full->face_normals());
+  expect_normals_equal(mesh_partial->vert_normals(), mesh_full->vert_normals());
+
+  BKE_id_free(nullptr, mesh_partial);
+  BKE_id_free(nullptr, mesh_full);
+}
+
+}  // namespace blender::bke::tests
@@ -854,6 +854,8 @@ static bool put_imbuf_cache(
                                          moviecache_getprioritydata,
                                          moviecache_getitempriority,
                                          moviecache_prioritydeleter);
+    /* Keep frames around the tracked position when other editors fill the cache. */
+    IMB_moviecache_set_memory_share(moviecache, 0.5f);
 
     clip->cache->moviecache = moviecache;
     clip->cache->sequence_offset = -1;
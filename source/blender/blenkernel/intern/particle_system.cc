@@ -3734,6 +3734,62 @@ static void dynamics_step_sphdata_reduce(const void *__restrict /*userdata*/,
   BLI_buffer_field_free(&sphdata_from->new_springs);
 }
 
+/**
+ * Brownian motion, collision response and effector noise draw from random number generators
+ * shared by all particles, so the result depends on the order in which particles are evaluated.
+ * Particle system effectors (including the simulated system itself with #PART_SELF_EFFECT) read
+ * the state of their particles while it is being written by the step.
+ * Only thread the Newtonian step when none of these are used, to keep simulations reproducible.
+ */
+static bool dynamics_step_newtonian_use_threading(ParticleSimulationData *sim)
+{
+  ParticleSystem *psys = sim->psys;
+  if (psys->totpart <= 100) {
+    return false;
+  }
+  if (psys->part->brownfac != 0.0f || sim->colliders) {
+    return false;
+  }
+  if (psys->effectors) {
+    LISTBASE_FOREACH (EffectorCache *, eff, psys->effectors) {
+      if (eff->psys) {
+        return false;
+      }
+      if (eff->pd && eff->pd->f_noise > 0.0f) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+static void dynamics_step_newtonian_task_cb_ex(void *__restrict userdata,
+                                               const int p,
+                                               const TaskParallelTLS *__restrict /*tls*/)
+{
+  DynamicStepSolverTaskData *data = static_cast<DynamicStepSolverTaskData *>(userdata);
+  ParticleSimulationData *sim = data->sim;
+  ParticleSystem *psys = sim->psys;
+  ParticleSettings *part = psys->part;
+
+  ParticleData *pa;
+
+  if ((pa = psys->particles + p)->state.time <= 0.0f) {
+    return;
+  }
+
+  /* do global forces & effectors */
+  basic_integrate(sim, p, pa->state.time, data->cfra);
+
+  /* deflection */
+  if (sim->colliders) {
+    collision_check(sim, p, pa->state.time, data->cfra);
+  }
+
+  /* rotations */
+  basic_rotate(part, pa, pa->state.time, data->timestep);
+}
+
 static void dynamics_step_sph_ddr_task_cb_ex(void *__restrict userdata,
                                              const int p,
                                              const TaskParallelTLS *__restrict tls)
@@ -3968,19 +4024,17 @@ static void dynamics_step(ParticleSimulationData *sim, float cfra)
 
   switch (part->phystype) {
     case PART_PHYS_NEWTON: {
-      LOOP_DYNAMIC_PARTICLES
-      {
-        /* do global forces & effectors */
-        basic_integrate(sim, p, pa->state.time, cfra);
-
-        /* deflection */
-        if (sim->colliders) {
-          collision_check(sim, p, pa->state.time, cfra);
-        }
+      DynamicStepSolverTaskData task_data{};
+      task_data.sim = sim;
+      task_data.cfra = cfra;
+      task_data.timestep = timestep;
+      task_data.dtime = dtime;
 
-        /* rotations */
-        basic_rotate(part, pa, pa->state.time, timestep);
-      }
+      TaskParallelSettings settings;
+      BLI_parallel_range_settings_defaults(&settings);
+      settings.use_threading = dynamics_step_newtonian_use_threading(sim);
+      BLI_task_parallel_range(
+          0, psys->totpart, &task_data, dynamics_step_newtonian_task_cb_ex, &settings);
       break;
     }
     case PART_PHYS_BOIDS: {
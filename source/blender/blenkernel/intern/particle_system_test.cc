@@ -0,0 +1,160 @@
+/* SPDX-FileCopyrightText: 2024 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+#include "testing/testing.h"
+
+#include "BKE_collection.hh"
+#include "BKE_effect.h"
+#include "BKE_idtype.hh"
+#include "BKE_layer.hh"
+#include "BKE_lib_id.hh"
+#include "BKE_main.hh"
+#include "BKE_mesh.h"
+#include "BKE_mesh.hh"
+#include "BKE_modifier.hh"
+#include "BKE_object.hh"
+#include "BKE_particle.h"
+#include "BKE_scene.hh"
+
+#include "BLI_math_vector_types.hh"
+#include "BLI_task.h"
+#include "BLI_vector.hh"
+
+#include "DEG_depsgraph.hh"
+#include "DEG_depsgraph_build.hh"
+#include "DEG_depsgraph_query.hh"
+
+#include "DNA_collection_types.h"
+#include "DNA_mesh_types.h"
+#include "DNA_object_force_types.h"
+#include "DNA_object_types.h"
+#include "DNA_particle_types.h"
+#include "DNA_scene_types.h"
+
+#include "CLG_log.h"
+
+namespace blender::bke::tests {
+
+class ParticleSystemTest : public testing::Test {
+ protected:
+  static void SetUpTestSuite()
+  {
+    CLG_init();
+    BKE_idtype_init();
+    /* The particle system is evaluated by its modifier. */
+    BKE_modifier_init();
+    DEG_register_node_types();
+  }
+
+  static void TearDownTestSuite()
+  {
+    DEG_free_node_types();
+    CLG_exit();
+  }
+
+  /**
+   * Build a scene with a single quad emitting 1000 particles, simulate it up to \a frame_end and
+   * return the particle positions. The particles are pushed either by their own force field
+   * (#PART_SELF_EFFECT) or by a force field object.
+   */
+  Vector<float3> simulate_particles(const bool use_self_effect, const int frame_end)
+  {
+    Main *bmain = BKE_main_new();
+    Scene *scene = BKE_scene_add(bmain, "Scene");
+    ViewLayer *view_layer = BKE_view_layer_default_view(scene);
+
+    Mesh *mesh_quad = BKE_mesh_new_nomain(4, 0, 1, 4);
+    mesh_quad->vert_positions_for_write().copy_from(
+        {float3(-1, -1, 0), float3(1, -1, 0), float3(1, 1, 0), float3(-1, 1, 0)});
+    mesh_quad->face_offsets_for_write().copy_from({0, 4});
+    mesh_quad->corner_verts_for_write().copy_from({0, 1, 2, 3});
+    mesh_calc_edges(*mesh_quad, false, false);
+
+    Mesh *mesh = BKE_mesh_add(bmain, "Emitter");
+    BKE_mesh_nomain_to_mesh(mesh_quad, mesh, nullptr);
+
+    Object *ob = BKE_object_add_only_object(bmain, OB_MESH, "Emitter");
+    ob->data = mesh;
+    id_us_plus(&mesh->id);
+    BKE_collection_object_add(bmain, scene->master_collection, ob);
+
+    object_add_particle_system(bmain, scene, ob, "Particles");
+    ParticleSystem *psys = static_cast<ParticleSystem *>(ob->particlesystem.first);
+    ParticleSettings *part = psys->part;
+    /* Enough particles for the dynamics step to be considered for threading. */
+    part->totpart = 1000;
+    part->sta = 1.0f;
+    part->end = 1.0f;
+    part->lifetime = 100.0f;
+
+    if (use_self_effect) {
+      part->flag |= PART_SELF_EFFECT;
+      if (part->pd == nullptr) {
+        part->pd = BKE_partdeflect_new(PFIELD_FORCE);
+      }
+      part->pd->forcefield = PFIELD_FORCE;
+      part->pd->f_strength = 5.0f;
+    }
+    else {
+      /* Without noise the field does not make the step fall back to serial evaluation. */
+      Object *ob_field = BKE_object_add_only_object(bmain, OB_EMPTY, "Field");
+      ob_field->loc[2] = 2.0f;
+      ob_field->pd = BKE_partdeflect_new(PFIELD_FORCE);
+      ob_field->pd->f_strength = 5.0f;
+      ob_field->pd->f_noise = 0.0f;
+      BKE_collection_object_add(bmain, scene->master_collection, ob_field);
+    }
+    BKE_view_layer_synced_ensure(scene, view_layer);
+
+    Depsgraph *depsgraph = DEG_graph_new(bmain, scene, view_layer, DAG_EVAL_VIEWPORT);
+    DEG_make_active(depsgraph);
+    DEG_graph_build_from_view_layer(depsgraph);
+
+    for (int frame = 1; frame <= frame_end; frame++) {
+      BKE_scene_frame_set(scene, float(frame));
+      DEG_evaluate_on_framechange(depsgraph, float(frame));
+    }
+
+    Vector<float3> positions;
+    Object *ob_eval = DEG_get_evaluated_object(depsgraph, ob);
+    const ParticleSystem *psys_eval = static_cast<const ParticleSystem *>(
+        ob_eval->particlesystem.first);
+    for (int p = 0; p < psys_eval->totpart; p++) {
+      positions.append(float3(psys_eval->particles[p].state.co));
+    }
+
+    DEG_graph_free(depsgraph);
+    BKE_main_free(bmain);
+    return positions;
+  }
+};
+
+TEST_F(ParticleSystemTest, newtonian_threaded_matches_serial)
+{
+  /* Until the task scheduler is initialized, parallel ranges run on the calling thread. */
+  const Vector<float3> positions_serial = simulate_particles(false, 10);
+  BLI_task_scheduler_init();
+  const Vector<float3> positions_threaded = simulate_particles(false, 10);
+
+  ASSERT_EQ(positions_serial.size(), 1000);
+  ASSERT_EQ(positions_serial.size(), positions_threaded.size());
+  for (const int64_t i : positions_serial.index_range()) {
+    EXPECT_EQ(positions_serial[i], positions_threaded[i]) << "Particle " << i;
+  }
+}
+
+TEST_F(ParticleSystemTest, self_effect_is_deterministic)
+{
+  BLI_task_scheduler_init();
+  const Vector<float3> positions_a = simulate_particles(true, 10);
+  const Vector<float3> positions_b = simulate_particles(true, 10);
+
+  ASSERT_EQ(positions_a.size(), 1000);
+  ASSERT_EQ(positions_a.size(), positions_b.size());
+  for (const int64_t i : positions_a.index_range()) {
+    EXPECT_EQ(positions_a[i], positions_b[i]) << "Particle " << i;
+  }
+}
+
+}  // namespace blender::bke::tests
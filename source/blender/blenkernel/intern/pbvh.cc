@@ -53,6 +53,8 @@ namespace blender::bke::pbvh {
 // #define DEBUG_BUILD_TIME
 #define LEAF_LIMIT 10000
 #define STACK_FIXED_DEPTH 100
+/* Above this number of primitives, the two children of a node are built in parallel. */
+#define PARALLEL_BUILD_LIMIT (LEAF_LIMIT * 4)
 
 /** Create invalid bounds for use with #math::min_max. */
 static Bounds<float3> negative_bounds()
@@ -235,6 +237,26 @@ static bool leaf_needs_material_split(const Span<int> prim_indices,
   return false;
 }
 
+/**
+ * Move a subtree that was built in a separate array into the main node array. The subtree's root
+ * replaces the (empty) node at \a root_index, the rest is appended at the end.
+ */
+static void append_subtree(MutableSpan<MeshNode> subtree,
+                           const int root_index,
+                           Vector<MeshNode> &nodes)
+{
+  const int offset = nodes.size() - 1;
+  for (MeshNode &node : subtree) {
+    if (!(node.flag_ & PBVH_Leaf)) {
+      node.children_offset_ += offset;
+    }
+  }
+  nodes[root_index] = std::move(subtree[0]);
+  for (MeshNode &node : subtree.drop_front(1)) {
+    nodes.append(std::move(node));
+  }
+}
+
 static void build_nodes_recursive_mesh(const Span<int> tri_faces,
                                        const Span<int> material_indices,
                                        const int leaf_limit,
@@ -290,9 +312,10 @@ static void build_nodes_recursive_mesh(const Span<int> tri_faces,
     }
     const int axis = math::dominant_axis(bounds.max - bounds.min);
 
-    /* Partition primitives along that axis */
+    /* Partition primitives along that axis. Use the part of the scratch buffer matching this
+     * node's primitives, so that sibling subtrees can be partitioned concurrently. */
     end = partition_prim_indices(prim_indices,
-                                 prim_scratch,
+                                 prim_scratch.slice(prim_offset, prims_num),
                                  prim_offset,
                                  prim_offset + prims_num,
                                  axis,
@@ -307,6 +330,46 @@ static void build_nodes_recursive_mesh(const Span<int> tri_faces,
   }
 
   /* Build children */
+  if (prims_num > PARALLEL_BUILD_LIMIT) {
+    /* The children cover separate ranges of the primitive arrays, so they can be built in
+     * parallel. Each gets its own node array, since building appends nodes. */
+    Vector<MeshNode> left_nodes(1);
+    Vector<MeshNode> right_nodes(1);
+    const int children_offset = nodes[node_index].children_offset_;
+    threading::parallel_invoke(
+        [&]() {
+          build_nodes_recursive_mesh(tri_faces,
+                                     material_indices,
+                                     leaf_limit,
+                                     0,
+                                     std::nullopt,
+                                     prim_bounds,
+                                     prim_offset,
+                                     end - prim_offset,
+                                     prim_scratch,
+                                     depth + 1,
+                                     prim_indices,
+                                     left_nodes);
+        },
+        [&]() {
+          build_nodes_recursive_mesh(tri_faces,
+                                     material_indices,
+                                     leaf_limit,
+                                     0,
+                                     std::nullopt,
+                                     prim_bounds,
+                                     end,
+                                     prim_offset + prims_num - end,
+                                     prim_scratch,
+                                     depth + 1,
+                                     prim_indices,
+                                     right_nodes);
+        });
+    append_subtree(left_nodes, children_offset, nodes);
+    append_subtree(right_nodes, children_offset + 1, nodes);
+    return;
+  }
+
   build_nodes_recursive_mesh(tri_faces,
                              material_indices,
                              leaf_limit,
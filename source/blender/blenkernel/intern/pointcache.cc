@@ -12,6 +12,7 @@
 #include <cstring>
 #include <sys/stat.h>
 #include <sys/types.h>
+#include <zstd.h>
 
 /* needed for directory lookup */
 #ifndef WIN32
@@ -1538,6 +1539,10 @@ static int ptcache_file_compressed_read(PTCacheFile *pf, uchar *result, uint len
         r = LzmaUncompress(result, &leno, in, &leni, props, sizeOfIt);
       }
 #endif
+      if (compressed == PTCACHE_COMPRESS_ZSTD) {
+        const size_t result_len = ZSTD_decompress(result, len, in, in_len);
+        r = (ZSTD_isError(result_len) || result_len != len) ? 1 : 0;
+      }
       MEM_freeN(in);
     }
   }
@@ -1599,6 +1604,17 @@ static int ptcache_file_compressed_write(
     }
   }
 #endif
+  if (mode == PTCACHE_COMPRESS_ZSTD) {
+    /* All callers allocate the output buffer with #LZO_OUT_LEN,
+     * a failing compression (including a too small buffer) falls back to no compression. */
+    out_len = ZSTD_compress(out, LZO_OUT_LEN(in_len), in, in_len, ZSTD_CLEVEL_DEFAULT);
+    if (ZSTD_isError(out_len) || (out_len >= in_len)) {
+      compressed = 0;
+    }
+    else {
+      compressed = PTCACHE_COMPRESS_ZSTD;
+    }
+  }
 
   ptcache_file_write(pf, &compressed, 1, sizeof(uchar));
   if (compressed) {
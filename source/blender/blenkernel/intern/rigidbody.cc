@@ -2037,6 +2037,12 @@ static void rigidbody_update_external_forces(Depsgraph *depsgraph,
                                              Scene *scene,
                                              RigidBodyWorld *rbw)
 {
+  EffectorWeights *effector_weights = rbw->effector_weights;
+  /* Get effectors present in the group specified by effector_weights. Only objects that are not
+   * effectors themselves are affected, so the list is the same for all of them and is only
+   * created once, instead of for every object. */
+  ListBase *effectors = BKE_effectors_create(depsgraph, nullptr, nullptr, effector_weights, false);
+
   FOREACH_COLLECTION_OBJECT_RECURSIVE_BEGIN (rbw->group, ob) {
     /* only update if rigid body exists */
     RigidBodyOb *rbo = ob->rigidbody_object;
@@ -2049,13 +2055,11 @@ static void rigidbody_update_external_forces(Depsgraph *depsgraph,
     if (rbo->type == RBO_TYPE_ACTIVE &&
         ((ob->pd == nullptr) || (ob->pd->forcefield == PFIELD_NULL)))
     {
-      EffectorWeights *effector_weights = rbw->effector_weights;
       EffectedPoint epoint;
-      ListBase *effectors;
 
-      /* get effectors present in the group specified by effector_weights */
-      effectors = BKE_effectors_create(depsgraph, ob, nullptr, effector_weights, false);
       if (effectors) {
+        /* Give every object the same noise as with its own effectors list. */
+        BKE_effectors_rng_reset(effectors);
         float eff_force[3] = {0.0f, 0.0f, 0.0f};
         float eff_loc[3], eff_vel[3];
 
@@ -2091,13 +2095,12 @@ static void rigidbody_update_external_forces(Depsgraph *depsgraph,
       else if (G.f & G_DEBUG) {
         printf("\tno forces to apply to '%s'\n", ob->id.name + 2);
       }
-
-      /* cleanup */
-      BKE_effectors_free(effectors);
     }
     /* NOTE: passive objects don't need to be updated since they don't move */
   }
   FOREACH_COLLECTION_OBJECT_RECURSIVE_END;
+
+  BKE_effectors_free(effectors);
 }
 
 static void rigidbody_free_substep_data(ListBase *substep_targets)
@@ -0,0 +1,122 @@
+/* SPDX-FileCopyrightText: 2024 Blender Authors
+ *
+ * SPDX-License-Identifier: Apache-2.0 */
+
+#include "testing/testing.h"
+
+#include "BLI_array.hh"
+#include "BLI_math_base.hh"
+#include "BLI_math_vector.hh"
+#include "BLI_math_vector_types.hh"
+#include "BLI_offset_indices.hh"
+#include "BLI_timeit.hh"
+
+#include "BKE_mesh.hh"
+#include "BKE_mesh_mapping.hh"
+
+namespace blender::bke::tests {
+
+/* Number of faces around each of the two poles. */
+static constexpr int POLE_VALENCE = 100'000;
+
+/**
+ * A closed bi-pyramid made of triangles, with two poles connected to every vertex of a ring. All
+ * edges are smooth, so the corners around each pole form a single cyclic smooth fan.
+ */
+struct BiPyramid {
+  Array<float3> positions;
+  Array<int2> edges;
+  Array<int> face_offsets;
+  Array<int> corner_verts;
+  Array<int> corner_edges;
+
+  BiPyramid(const int ring_size)
+  {
+    const int top = 0;
+    const int bottom = 1;
+    const auto ring_vert = [&](const int i) { return 2 + i % ring_size; };
+    const auto top_edge = [&](const int i) { return i % ring_size; };
+    const auto bottom_edge = [&](const int i) { return ring_size + i % ring_size; };
+    const auto ring_edge = [&](const int i) { return 2 * ring_size + i % ring_size; };
+
+    positions.reinitialize(2 + ring_size);
+    positions[top] = float3(0.0f, 0.0f, 1.0f);
+    positions[bottom] = float3(0.0f, 0.0f, -1.0f);
+    for (const int i : IndexRange(ring_size)) {
+      const float angle = 2.0f * float(M_PI) * float(i) / float(ring_size);
+      positions[ring_vert(i)] = float3(std::cos(angle), std::sin(angle), 0.0f);
+    }
+
+    edges.reinitialize(3 * ring_size);
+    for (const int i : IndexRange(ring_size)) {
+      edges[top_edge(i)] = int2(top, ring_vert(i));
+      edges[bottom_edge(i)] = int2(bottom, ring_vert(i));
+      edges[ring_edge(i)] = int2(ring_vert(i), ring_vert(i + 1));
+    }
+
+    const int faces_num = 2 * ring_size;
+    face_offsets.reinitialize(faces_num + 1);
+    for (const int i : face_offsets.index_range()) {
+      face_offsets[i] = 3 * i;
+    }
+
+    corner_verts.reinitialize(3 * faces_num);
+    corner_edges.reinitialize(3 * faces_num);
+    for (const int i : IndexRange(ring_size)) {
+      const int top_face = 3 * i;
+      corner_verts.as_mutable_span().slice(top_face, 3).copy_from(
+          {top, ring_vert(i), ring_vert(i + 1)});
+      corner_edges.as_mutable_span().slice(top_face, 3).copy_from(
+          {top_edge(i), ring_edge(i), top_edge(i + 1)});
+
+      const int bottom_face = 3 * (ring_size + i);
+      corner_verts.as_mutable_span().slice(bottom_face, 3).copy_from(
+          {bottom, ring_vert(i + 1), ring_vert(i)});
+      corner_edges.as_mutable_span().slice(bottom_face, 3).copy_from(
+          {bottom_edge(i + 1), ring_edge(i), bottom_edge(i)});
+    }
+  }
+};
+
+TEST(mesh_normals_performance, CornerNormalsHighValencePole)
+{
+  const BiPyramid mesh(POLE_VALENCE);
+  const OffsetIndices<int> faces(mesh.face_offsets);
+  const Array<int> corner_to_face = mesh::build_corner_to_face_map(faces);
+
+  Array<int> vert_to_face_offsets;
+  Array<int> vert_to_face_indices;
+  const GroupedSpan<int> vert_to_face_map = mesh::build_vert_to_face_map(
+      faces, mesh.corner_verts, mesh.positions.size(), vert_to_face_offsets, vert_to_face_indices);
+
+  Array<float3> face_normals(faces.size());
+  mesh::normals_calc_faces(mesh.positions, faces, mesh.corner_verts, face_normals);
+  Array<float3> vert_normals(mesh.positions.size());
+  mesh::normals_calc_verts(
+      mesh.positions, faces, mesh.corner_verts, vert_to_face_map, face_normals, vert_normals);
+
+  Array<float3> corner_normals(mesh.corner_verts.size());
+  mesh::CornerNormalSpaceArray lnors_spacearr;
+  {
+    SCOPED_TIMER("corner normals with high valence poles");
+    mesh::normals_calc_corners(mesh.positions,
+                               mesh.edges,
+                               faces,
+                               mesh.corner_verts,
+                               mesh.corner_edges,
+                               corner_to_face,
+                               vert_normals,
+                               face_normals,
+                               {},
+                               {},
+                               nullptr,
+                               &lnors_spacearr,
+                               corner_normals);
+  }
+
+  /* Every vertex is the pivot of exactly one smooth fan. */
+  EXPECT_EQ(lnors_spacearr.spaces.size(), mesh.positions.size());
+  EXPECT_NEAR(math::dot(corner_normals[0], float3(0.0f, 0.0f, 1.0f)), 1.0f, 1e-4f);
+}
+
+}  // namespace blender::bke::tests
@@ -54,6 +54,13 @@ typedef struct FileReader {
 FileReader *BLI_filereader_new_file(int filedes) ATTR_WARN_UNUSED_RESULT;
 /** Create #FileReader from raw file descriptor using memory-mapped IO. */
 FileReader *BLI_filereader_new_mmap(int filedes) ATTR_WARN_UNUSED_RESULT;
+/**
+ * Return the memory-mapped file backing \a reader when it was created by
+ * #BLI_filereader_new_mmap, NULL otherwise.
+ * This allows reading data in-place instead of copying it through #FileReader.read.
+ */
+struct BLI_mmap_file *BLI_filereader_mmap_file(FileReader *reader) ATTR_WARN_UNUSED_RESULT
+    ATTR_NONNULL();
 /** Create #FileReader from a region of memory. */
 FileReader *BLI_filereader_new_memory(const void *data, size_t len) ATTR_WARN_UNUSED_RESULT
     ATTR_NONNULL();
@@ -32,6 +32,16 @@
 #  endif
 #endif
 
+/**
+ * Uncomment to measure the tasks of every #parallel_for call site. When Blender exits, call sites
+ * whose tasks are much smaller or larger than useful are printed, to help tuning grain sizes.
+ */
+// #define BLI_TASK_DEBUG_GRAIN_SIZE
+
+#ifdef BLI_TASK_DEBUG_GRAIN_SIZE
+#  include <typeinfo>
+#endif
+
 #include "BLI_function_ref.hh"
 #include "BLI_index_range.hh"
 #include "BLI_lazy_threading.hh"
@@ -72,6 +82,15 @@ void parallel_for_impl(IndexRange range,
                        FunctionRef<void(IndexRange)> function,
                        const TaskSizeHints &size_hints);
 void memory_bandwidth_bound_task_impl(FunctionRef<void()> function);
+#ifdef BLI_TASK_DEBUG_GRAIN_SIZE
+struct ParallelForCallSite;
+ParallelForCallSite &parallel_for_call_site_get(const char *name);
+void parallel_for_debug_impl(ParallelForCallSite &call_site,
+                             IndexRange range,
+                             int64_t grain_size,
+                             FunctionRef<void(IndexRange)> function,
+                             const TaskSizeHints &size_hints);
+#endif
 }  // namespace detail
 
 /**
@@ -105,7 +124,14 @@ inline void parallel_for(const IndexRange range,
     function(range);
     return;
   }
+#ifdef BLI_TASK_DEBUG_GRAIN_SIZE
+  /* Every lambda has its own type, so each call site gets its own statistics. */
+  static detail::ParallelForCallSite &call_site = detail::parallel_for_call_site_get(
+      typeid(Function).name());
+  detail::parallel_for_debug_impl(call_site, range, grain_size, function, size_hints);
+#else
   detail::parallel_for_impl(range, grain_size, function, size_hints);
+#endif
 }
 
 /**
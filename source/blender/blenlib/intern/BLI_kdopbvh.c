@@ -1027,17 +1027,41 @@ bool BLI_bvhtree_update_node(
   return true;
 }
 
+static void bvhtree_update_tree_task_cb(void *__restrict userdata,
+                                        const int j,
+                                        const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  BVHTree *tree = userdata;
+  node_join(tree, tree->nodes[tree->leaf_num + j - 1]);
+}
+
 void BLI_bvhtree_update_tree(BVHTree *tree)
 {
   /* Update bottom=>top
    * TRICKY: the way we build the tree all the children have an index greater than the parent
-   * This allows us todo a bottom up update by starting on the bigger numbered branch. */
+   * This allows us todo a bottom up update by starting on the bigger numbered branch.
+   *
+   * The implicit tree stores its branches level by level (see #non_recursive_bvh_div_nodes),
+   * so all branches of one level only depend on the level below and can be joined in parallel. */
+  const int tree_type = tree->tree_type;
+  const int tree_offset = 2 - tree->tree_type;
+  const int branches_num = tree->branch_num;
+
+  int level_starts[64];
+  int levels_num = 0;
+  for (int i = 1; i <= branches_num; i = i * tree_type + tree_offset) {
+    BLI_assert(levels_num < (int)ARRAY_SIZE(level_starts));
+    level_starts[levels_num++] = i;
+  }
 
-  BVHNode **root = tree->nodes + tree->leaf_num;
-  BVHNode **index = tree->nodes + tree->leaf_num + tree->branch_num - 1;
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.use_threading = (tree->leaf_num > KDOPBVH_THREAD_LEAF_THRESHOLD);
 
-  for (; index >= root; index--) {
-    node_join(tree, *index);
+  for (int level = levels_num - 1; level >= 0; level--) {
+    const int i = level_starts[level];
+    const int i_stop = min_ii(i * tree_type + tree_offset, branches_num + 1);
+    BLI_task_parallel_range(i, i_stop, tree, bvhtree_update_tree_task_cb, &settings);
   }
 }
 int BLI_bvhtree_get_len(const BVHTree *tree)
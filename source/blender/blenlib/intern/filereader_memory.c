@@ -128,3 +128,12 @@ FileReader *BLI_filereader_new_mmap(int filedes)
 
   return (FileReader *)mem;
 }
+
+BLI_mmap_file *BLI_filereader_mmap_file(FileReader *reader)
+{
+  if (reader->read != memory_read_mmap) {
+    return NULL;
+  }
+  MemoryReader *mem = (MemoryReader *)reader;
+  return mem->mmap;
+}
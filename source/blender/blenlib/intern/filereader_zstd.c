@@ -11,6 +11,7 @@
 
 #include "BLI_filereader.h"
 #include "BLI_math_base.h"
+#include "BLI_task.h"
 
 #ifdef __BIG_ENDIAN__
 #  include "BLI_endian_switch.h"
@@ -18,6 +19,15 @@
 
 #include "MEM_guardedalloc.h"
 
+/**
+ * Number of decompressed frames of a seekable file that are kept in memory.
+ *
+ * Blender writes frames of about 1 MB, so this keeps memory usage bounded while still allowing to
+ * seek back to recently read data (e.g. when reading #BHead data on demand) without decompressing
+ * the frames again. This is also the maximum number of frames decompressed in parallel.
+ */
+#define ZSTD_SEEK_CACHE_SIZE 8
+
 typedef struct {
   FileReader reader;
 
@@ -32,8 +42,14 @@ typedef struct {
     size_t *compressed_ofs;
     size_t *uncompressed_ofs;
 
-    char *cached_content;
-    int cached_frame;
+    /* Direct-mapped cache, frame `i` is stored in slot `i % ZSTD_SEEK_CACHE_SIZE`. */
+    char *cached_content[ZSTD_SEEK_CACHE_SIZE];
+    int cached_frame[ZSTD_SEEK_CACHE_SIZE];
+
+    /* Number of frames decompressed at once, grows while the file is read sequentially. */
+    int readahead;
+    /* The frame following the last decompressed batch, to detect sequential reading. */
+    int next_frame;
   } seek;
 } ZstdReader;
 
@@ -129,7 +145,11 @@ static bool zstd_read_seek_table(ZstdReader *zstd)
     return false;
   }
 
-  zstd->seek.cached_frame = -1;
+  for (int i = 0; i < ZSTD_SEEK_CACHE_SIZE; i++) {
+    zstd->seek.cached_frame[i] = -1;
+  }
+  zstd->seek.readahead = 1;
+  zstd->seek.next_frame = -1;
 
   return true;
 }
@@ -157,42 +177,118 @@ static int zstd_frame_from_pos(ZstdReader *zstd, size_t pos)
   return low;
 }
 
-/* Ensure that the currently loaded frame is the correct one. */
+typedef struct ZstdDecompressData {
+  ZstdReader *zstd;
+  /* First frame of the batch, and the compressed data of all frames in the batch. */
+  int first_frame;
+  const char *compressed_data;
+  /* Only use the reader's context when decompressing a single frame without threading. */
+  bool use_reader_ctx;
+} ZstdDecompressData;
+
+static void zstd_decompress_frame_fn(void *__restrict userdata,
+                                     const int iter,
+                                     const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  ZstdDecompressData *data = userdata;
+  ZstdReader *zstd = data->zstd;
+  const int frame = data->first_frame + iter;
+  const int slot = frame % ZSTD_SEEK_CACHE_SIZE;
+
+  const size_t compressed_size = zstd->seek.compressed_ofs[frame + 1] -
+                                 zstd->seek.compressed_ofs[frame];
+  const size_t uncompressed_size = zstd->seek.uncompressed_ofs[frame + 1] -
+                                   zstd->seek.uncompressed_ofs[frame];
+  const size_t offset_in_batch = zstd->seek.compressed_ofs[frame] -
+                                 zstd->seek.compressed_ofs[data->first_frame];
+  const char *compressed_data = data->compressed_data + offset_in_batch;
+
+  char *uncompressed_data = MEM_mallocN(uncompressed_size, __func__);
+  const size_t res = data->use_reader_ctx ? ZSTD_decompressDCtx(zstd->ctx,
+                                                                uncompressed_data,
+                                                                uncompressed_size,
+                                                                compressed_data,
+                                                                compressed_size) :
+                                            ZSTD_decompress(uncompressed_data,
+                                                            uncompressed_size,
+                                                            compressed_data,
+                                                            compressed_size);
+  if (ZSTD_isError(res) || res < uncompressed_size) {
+    MEM_freeN(uncompressed_data);
+    uncompressed_data = NULL;
+  }
+  /* Each frame of a batch maps to a different slot, so there is no concurrent access. */
+  zstd->seek.cached_content[slot] = uncompressed_data;
+}
+
+/* Ensure that the given frame is loaded in the cache. When reading sequentially, the following
+ * frames are decompressed in parallel as well. */
 static const char *zstd_ensure_cache(ZstdReader *zstd, int frame)
 {
-  if (zstd->seek.cached_frame == frame) {
+  const int slot = frame % ZSTD_SEEK_CACHE_SIZE;
+  if (zstd->seek.cached_frame[slot] == frame) {
     /* Cached frame matches, so just return it. */
-    return zstd->seek.cached_content;
+    return zstd->seek.cached_content[slot];
   }
 
-  /* Cached frame doesn't match, so discard it and cache the wanted one instead. */
-  MEM_SAFE_FREE(zstd->seek.cached_content);
+  /* Only read ahead when reading sequentially, partial reads (e.g. for thumbnails or linking a
+   * single data-block) should only decompress the frames they need. */
+  if (frame == zstd->seek.next_frame) {
+    zstd->seek.readahead = min_ii(zstd->seek.readahead * 2, ZSTD_SEEK_CACHE_SIZE);
+  }
+  else {
+    zstd->seek.readahead = 1;
+  }
+  int frames_len = 1;
+  while (frames_len < zstd->seek.readahead && frame + frames_len < zstd->seek.frames_num) {
+    const int next = frame + frames_len;
+    if (zstd->seek.cached_frame[next % ZSTD_SEEK_CACHE_SIZE] == next) {
+      break;
+    }
+    frames_len++;
+  }
+  zstd->seek.next_frame = frame + frames_len;
 
-  size_t compressed_size = zstd->seek.compressed_ofs[frame + 1] - zstd->seek.compressed_ofs[frame];
-  size_t uncompressed_size = zstd->seek.uncompressed_ofs[frame + 1] -
-                             zstd->seek.uncompressed_ofs[frame];
+  /* Discard the cached frames whose slots are reused. */
+  for (int i = 0; i < frames_len; i++) {
+    const int frame_slot = (frame + i) % ZSTD_SEEK_CACHE_SIZE;
+    MEM_SAFE_FREE(zstd->seek.cached_content[frame_slot]);
+    zstd->seek.cached_frame[frame_slot] = -1;
+  }
 
-  char *uncompressed_data = MEM_mallocN(uncompressed_size, __func__);
+  /* Frames are stored contiguously, so the whole batch can be read at once. */
+  const size_t compressed_size = zstd->seek.compressed_ofs[frame + frames_len] -
+                                 zstd->seek.compressed_ofs[frame];
   char *compressed_data = MEM_mallocN(compressed_size, __func__);
   if (zstd->base->seek(zstd->base, zstd->seek.compressed_ofs[frame], SEEK_SET) < 0 ||
       zstd->base->read(zstd->base, compressed_data, compressed_size) < compressed_size)
   {
     MEM_freeN(compressed_data);
-    MEM_freeN(uncompressed_data);
+    zstd->seek.next_frame = -1;
     return NULL;
   }
 
-  size_t res = ZSTD_decompressDCtx(
-      zstd->ctx, uncompressed_data, uncompressed_size, compressed_data, compressed_size);
+  ZstdDecompressData data = {
+      .zstd = zstd,
+      .first_frame = frame,
+      .compressed_data = compressed_data,
+      .use_reader_ctx = frames_len == 1,
+  };
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.use_threading = frames_len > 1;
+  settings.min_iter_per_thread = 1;
+  BLI_task_parallel_range(0, frames_len, &data, zstd_decompress_frame_fn, &settings);
   MEM_freeN(compressed_data);
-  if (ZSTD_isError(res) || res < uncompressed_size) {
-    MEM_freeN(uncompressed_data);
-    return NULL;
+
+  for (int i = 0; i < frames_len; i++) {
+    const int frame_slot = (frame + i) % ZSTD_SEEK_CACHE_SIZE;
+    if (zstd->seek.cached_content[frame_slot] != NULL) {
+      zstd->seek.cached_frame[frame_slot] = frame + i;
+    }
   }
 
-  zstd->seek.cached_frame = frame;
-  zstd->seek.cached_content = uncompressed_data;
-  return uncompressed_data;
+  return zstd->seek.cached_content[slot];
 }
 
 static int64_t zstd_read_seekable(FileReader *reader, void *buffer, size_t size)
@@ -285,9 +381,9 @@ static void zstd_close(FileReader *reader)
   if (zstd->reader.seek) {
     MEM_freeN(zstd->seek.uncompressed_ofs);
     MEM_freeN(zstd->seek.compressed_ofs);
-    /* When an error has occurred this may be NULL, see: #99744. */
-    if (zstd->seek.cached_content) {
-      MEM_freeN(zstd->seek.cached_content);
+    for (int i = 0; i < ZSTD_SEEK_CACHE_SIZE; i++) {
+      /* When an error has occurred this may be NULL, see: #99744. */
+      MEM_SAFE_FREE(zstd->seek.cached_content[i]);
     }
   }
   else {
@@ -10,6 +10,7 @@
 
 #include "BLI_kdtree_impl.h"
 #include "BLI_math_base.h"
+#include "BLI_task.h"
 #include "BLI_utildefines.h"
 
 #include <string.h>
@@ -139,19 +140,15 @@ void BLI_kdtree_nd_(insert)(KDTree *tree, int index, const float co[KD_DIMS])
 #endif
 }
 
-static uint kdtree_balance(KDTreeNode *nodes, uint nodes_len, uint axis, const uint ofs)
+/**
+ * Sort the nodes so that the median along the axis is in the middle, all nodes before it are not
+ * larger and all nodes after it are not smaller. Returns the index of the median.
+ */
+static uint kdtree_partition_median(KDTreeNode *nodes, uint nodes_len, uint axis)
 {
-  KDTreeNode *node;
   float co;
   uint left, right, median, i, j;
 
-  if (nodes_len <= 0) {
-    return KD_NODE_UNSET;
-  }
-  else if (nodes_len == 1) {
-    return 0 + ofs;
-  }
-
   /* Quick-sort style sorting around median. */
   left = 0;
   right = nodes_len - 1;
@@ -184,6 +181,23 @@ static uint kdtree_balance(KDTreeNode *nodes, uint nodes_len, uint axis, const u
     }
   }
 
+  return median;
+}
+
+static uint kdtree_balance(KDTreeNode *nodes, uint nodes_len, uint axis, const uint ofs)
+{
+  KDTreeNode *node;
+  uint median;
+
+  if (nodes_len <= 0) {
+    return KD_NODE_UNSET;
+  }
+  else if (nodes_len == 1) {
+    return 0 + ofs;
+  }
+
+  median = kdtree_partition_median(nodes, nodes_len, axis);
+
   /* Set node and sort sub-nodes. */
   node = &nodes[median];
   node->d = axis;
@@ -195,6 +209,59 @@ static uint kdtree_balance(KDTreeNode *nodes, uint nodes_len, uint axis, const u
   return median + ofs;
 }
 
+/**
+ * Balancing two sub-trees only touches disjoint ranges of nodes, so large sub-trees are balanced
+ * in parallel. The root of a sub-tree is always at its median, which means the child indices are
+ * known before the sub-trees are done.
+ */
+#define KD_BALANCE_PARALLEL_NODES_MIN 8192
+
+typedef struct KDTreeBalanceTask {
+  KDTreeNode *nodes;
+  uint nodes_len;
+  uint axis;
+  uint ofs;
+} KDTreeBalanceTask;
+
+static uint kdtree_subtree_root(const uint nodes_len, const uint ofs)
+{
+  return nodes_len == 0 ? KD_NODE_UNSET : (nodes_len / 2) + ofs;
+}
+
+static void kdtree_balance_task(TaskPool *__restrict pool, void *taskdata);
+
+static void kdtree_balance_parallel(
+    TaskPool *pool, KDTreeNode *nodes, uint nodes_len, uint axis, const uint ofs)
+{
+  if (nodes_len < KD_BALANCE_PARALLEL_NODES_MIN) {
+    kdtree_balance(nodes, nodes_len, axis, ofs);
+    return;
+  }
+
+  const uint median = kdtree_partition_median(nodes, nodes_len, axis);
+  const uint right_len = nodes_len - (median + 1);
+  KDTreeNode *node = &nodes[median];
+  node->d = axis;
+  axis = (axis + 1) % KD_DIMS;
+  node->left = kdtree_subtree_root(median, ofs);
+  node->right = kdtree_subtree_root(right_len, (median + 1) + ofs);
+
+  KDTreeBalanceTask *task = MEM_mallocN(sizeof(*task), __func__);
+  task->nodes = nodes + median + 1;
+  task->nodes_len = right_len;
+  task->axis = axis;
+  task->ofs = (median + 1) + ofs;
+  BLI_task_pool_push(pool, kdtree_balance_task, task, true, NULL);
+
+  kdtree_balance_parallel(pool, nodes, median, axis, ofs);
+}
+
+static void kdtree_balance_task(TaskPool *__restrict pool, void *taskdata)
+{
+  const KDTreeBalanceTask *task = taskdata;
+  kdtree_balance_parallel(pool, task->nodes, task->nodes_len, task->axis, task->ofs);
+}
+
 void BLI_kdtree_nd_(balance)(KDTree *tree)
 {
   if (tree->root != KD_NODE_ROOT_IS_INIT) {
@@ -204,7 +271,16 @@ void BLI_kdtree_nd_(balance)(KDTree *tree)
     }
   }
 
-  tree->root = kdtree_balance(tree->nodes, tree->nodes_len, 0, 0);
+  if (tree->nodes_len < KD_BALANCE_PARALLEL_NODES_MIN) {
+    tree->root = kdtree_balance(tree->nodes, tree->nodes_len, 0, 0);
+  }
+  else {
+    TaskPool *pool = BLI_task_pool_create(NULL, TASK_PRIORITY_HIGH);
+    kdtree_balance_parallel(pool, tree->nodes, tree->nodes_len, 0, 0);
+    BLI_task_pool_work_and_wait(pool);
+    BLI_task_pool_free(pool);
+    tree->root = kdtree_subtree_root(tree->nodes_len, 0);
+  }
 
 #ifndef NDEBUG
   tree->is_balanced = true;
@@ -1155,7 +1155,7 @@ static inline mpq3 tti_interp(
 /**
  * Return +1, 0, -1 as a + ad is above, on, or below the oriented plane containing a, b, c in CCW
  * order. This is the same as -oriented(a, b, c, a + ad), but uses fewer arithmetic operations.
- * TODO: change arguments to `const Vert *` and use floating filters.
+ * Callers should try #filter_tti_above first, which avoids the exact arithmetic in most cases.
  * The ba, ca, n, and dotbuf arguments are used as temporaries; declaring them
  * in the caller can avoid many allocations and frees of mpq3 and mpq_class structures.
  */
@@ -1180,6 +1180,49 @@ static inline int tti_above(const mpq3 &a,
   return sgn(math::dot_with_buffer(ad, n, dotbuf));
 }
 
+/**
+ * Index of the expression computed by #filter_tti_above, assuming all input coordinates have
+ * index 1 because they are rounded from exact values.
+ */
+constexpr int index_tti_above = 11;
+
+/**
+ * Floating point filter for #tti_above. The arguments are double approximations of the exact
+ * coordinates, and `sup_*` are the suprema of `b - a`, `c - a` and `ad` in the sense of
+ * #filter_plane_side. Returns +1 or -1 if the sign of the exact result is known for certain,
+ * and 0 if #tti_above has to be used instead.
+ */
+static inline int filter_tti_above(const double3 &a,
+                                   const double3 &b,
+                                   const double3 &c,
+                                   const double3 &ad,
+                                   const double3 &sup_ba,
+                                   const double3 &sup_ca,
+                                   const double3 &sup_ad)
+{
+  const double3 ba = b - a;
+  const double3 ca = c - a;
+  const double3 n(ba.y * ca.z - ba.z * ca.y, ba.z * ca.x - ba.x * ca.z, ba.x * ca.y - ba.y * ca.x);
+  const double d = math::dot(ad, n);
+  if (d == 0.0) {
+    return 0;
+  }
+  const double3 sup_n(sup_ba.y * sup_ca.z + sup_ba.z * sup_ca.y,
+                      sup_ba.z * sup_ca.x + sup_ba.x * sup_ca.z,
+                      sup_ba.x * sup_ca.y + sup_ba.y * sup_ca.x);
+  const double supremum = math::dot(sup_ad, sup_n);
+  const double err_bound = supremum * index_tti_above * DBL_EPSILON;
+  if (fabs(d) > err_bound) {
+    return d > 0 ? 1 : -1;
+  }
+  return 0;
+}
+
+static inline double3 approximate_double3(const mpq3 &co)
+{
+  return double3(co[0].get_d(), co[1].get_d(), co[2].get_d());
+}
+
 /**
  * Given that triangles (p1, q1, r1) and (p2, q2, r2) are in canonical order,
  * use the classification chart in the Guigue and Devillers paper to find out
@@ -1223,12 +1266,35 @@ static ITT_value itt_canon2(const mpq3 &p1,
   mpq3 intersect_2;
   mpq3 buf[4];
   bool no_overlap = false;
+
+  /* All orientation tests below are relative to p1 along p1p2. Try to decide them with doubles
+   * first, which avoids most of the exact arithmetic. */
+  const double3 d_p1 = approximate_double3(p1);
+  const double3 abs_d_p1 = math::abs(d_p1);
+  const double3 d_p1p2 = approximate_double3(p2) - d_p1;
+  const double3 sup_p1p2 = math::abs(approximate_double3(p2)) + abs_d_p1;
+  auto above = [&](const mpq3 &b, const mpq3 &c) {
+    const double3 d_b = approximate_double3(b);
+    const double3 d_c = approximate_double3(c);
+    const int filter_result = filter_tti_above(d_p1,
+                                               d_b,
+                                               d_c,
+                                               d_p1p2,
+                                               math::abs(d_b) + abs_d_p1,
+                                               math::abs(d_c) + abs_d_p1,
+                                               sup_p1p2);
+    if (filter_result != 0) {
+      return filter_result;
+    }
+    return tti_above(p1, b, c, p1p2, buf[0], buf[1], buf[2], buf[3]);
+  };
+
   /* Top test in classification tree. */
-  if (tti_above(p1, q1, r2, p1p2, buf[0], buf[1], buf[2], buf[3]) > 0) {
+  if (above(q1, r2) > 0) {
     /* Middle right test in classification tree. */
-    if (tti_above(p1, r1, r2, p1p2, buf[0], buf[1], buf[2], buf[3]) <= 0) {
+    if (above(r1, r2) <= 0) {
       /* Bottom right test in classification tree. */
-      if (tti_above(p1, r1, q2, p1p2, buf[0], buf[1], buf[2], buf[3]) > 0) {
+      if (above(r1, q2) > 0) {
         /* Overlap is [k [i l] j]. */
         if (dbg_level > 0) {
           std::cout << "overlap [k [i l] j]\n";
@@ -1257,7 +1323,7 @@ static ITT_value itt_canon2(const mpq3 &p1,
   }
   else {
     /* Middle left test in classification tree. */
-    if (tti_above(p1, q1, q2, p1p2, buf[0], buf[1], buf[2], buf[3]) < 0) {
+    if (above(q1, q2) < 0) {
       /* No overlap: [i j] [k l]. */
       if (dbg_level > 0) {
         std::cout << "no overlap: [i j] [k l]\n";
@@ -1266,7 +1332,7 @@ static ITT_value itt_canon2(const mpq3 &p1,
     }
     else {
       /* Bottom left test in classification tree. */
-      if (tti_above(p1, r1, q2, p1p2, buf[0], buf[1], buf[2], buf[3]) >= 0) {
+      if (above(r1, q2) >= 0) {
         /* Overlap is [k [i j] l]. */
         if (dbg_level > 0) {
           std::cout << "overlap [k [i j] l]\n";
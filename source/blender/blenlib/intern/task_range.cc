@@ -8,7 +8,12 @@
  * Task parallel range functions.
  */
 
+#include <atomic>
+#include <chrono>
+#include <cstdio>
 #include <cstdlib>
+#include <list>
+#include <mutex>
 
 #include "MEM_guardedalloc.h"
 
@@ -286,6 +291,94 @@ void parallel_for_impl(const IndexRange range,
 #endif
 }
 
+#ifdef BLI_TASK_DEBUG_GRAIN_SIZE
+
+struct ParallelForCallSite {
+  const char *name;
+  std::atomic<int64_t> calls = 0;
+  std::atomic<int64_t> tasks = 0;
+  std::atomic<int64_t> nanoseconds = 0;
+
+  ParallelForCallSite(const char *name) : name(name) {}
+};
+
+/** Owns the statistics of all call sites and reports the badly tuned ones on exit. */
+struct ParallelForCallSites {
+  std::mutex mutex;
+  /* A list, so that references to the call sites stay valid. */
+  std::list<ParallelForCallSite> call_sites;
+
+  ~ParallelForCallSites()
+  {
+    /* Tasks that are shorter than this spend a significant amount of time in scheduling. */
+    const int64_t min_task_ns = 20 * 1000;
+    /* Tasks that are longer than this give the scheduler little room for load balancing. */
+    const int64_t max_task_ns = 2 * 1000 * 1000;
+    const int threads_num = BLI_task_scheduler_num_threads();
+
+    for (const ParallelForCallSite &call_site : call_sites) {
+      const int64_t tasks = call_site.tasks;
+      if (tasks == 0) {
+        continue;
+      }
+      const int64_t calls = call_site.calls;
+      const int64_t task_ns = call_site.nanoseconds / tasks;
+      const char *issue = nullptr;
+      if (task_ns < min_task_ns) {
+        issue = "tasks too small, increase grain size";
+      }
+      else if (task_ns > max_task_ns && tasks / calls < threads_num) {
+        issue = "too few tasks, decrease grain size";
+      }
+      if (issue) {
+        printf("parallel_for: %s (calls: %lld, tasks per call: %lld, average task: %lld us)\n"
+               "  %s\n",
+               issue,
+               (long long)calls,
+               (long long)(tasks / calls),
+               (long long)(task_ns / 1000),
+               call_site.name);
+      }
+    }
+  }
+};
+
+static ParallelForCallSites &parallel_for_call_sites()
+{
+  static ParallelForCallSites call_sites;
+  return call_sites;
+}
+
+ParallelForCallSite &parallel_for_call_site_get(const char *name)
+{
+  ParallelForCallSites &call_sites = parallel_for_call_sites();
+  std::lock_guard lock{call_sites.mutex};
+  return call_sites.call_sites.emplace_back(name);
+}
+
+void parallel_for_debug_impl(ParallelForCallSite &call_site,
+                             const IndexRange range,
+                             const int64_t grain_size,
+                             const FunctionRef<void(IndexRange)> function,
+                             const TaskSizeHints &size_hints)
+{
+  call_site.calls++;
+  parallel_for_impl(
+      range,
+      grain_size,
+      [&](const IndexRange sub_range) {
+        const auto start = std::chrono::steady_clock::now();
+        function(sub_range);
+        const auto end = std::chrono::steady_clock::now();
+        call_site.tasks++;
+        call_site.nanoseconds +=
+            std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+      },
+      size_hints);
+}
+
+#endif /* BLI_TASK_DEBUG_GRAIN_SIZE */
+
 void memory_bandwidth_bound_task_impl(const FunctionRef<void()> function)
 {
 #ifdef WITH_TBB
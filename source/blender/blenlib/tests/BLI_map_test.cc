@@ -677,6 +677,28 @@ TEST(map, LookupKey)
   EXPECT_EQ(map.lookup_key_ptr("a"), map.lookup_key_ptr_as("a"));
 }
 
+TEST(map, StringKeyHashedSlot)
+{
+  Map<std::string, int> map;
+  static_assert(std::is_same_v<DefaultMapSlot<std::string, int>::type,
+                               HashedMapSlot<std::string, int>>);
+  for (const int i : IndexRange(1000)) {
+    map.add(std::to_string(i), i);
+  }
+  EXPECT_EQ(map.size(), 1000);
+  for (int i = 0; i < 1000; i += 2) {
+    EXPECT_TRUE(map.remove(std::to_string(i)));
+  }
+  EXPECT_EQ(map.size(), 500);
+  /* Copying and growing reuse the hashes stored in the slots. */
+  Map<std::string, int> map_copy = map;
+  map_copy.reserve(10000);
+  for (const int i : IndexRange(1000)) {
+    EXPECT_EQ(map_copy.lookup_default(std::to_string(i), -1), i % 2 ? i : -1);
+  }
+  EXPECT_EQ(map_copy.lookup_as(StringRef("999")), 999);
+}
+
 TEST(map, VectorKey)
 {
   Map<Vector<int>, int> map;
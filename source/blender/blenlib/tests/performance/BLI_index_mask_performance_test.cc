@@ -0,0 +1,114 @@
+/* SPDX-FileCopyrightText: 2024 Blender Authors
+ *
+ * SPDX-License-Identifier: Apache-2.0 */
+
+#include "testing/testing.h"
+
+#include "BLI_array.hh"
+#include "BLI_array_utils.hh"
+#include "BLI_index_mask.hh"
+#include "BLI_offset_indices.hh"
+#include "BLI_rand.hh"
+#include "BLI_timeit.hh"
+
+namespace blender::index_mask::tests {
+
+/* Big enough for the multi-threaded code paths to be taken. */
+static constexpr int64_t ELEMENTS_NUM = 10'000'000;
+
+TEST(index_mask_performance, FromPredicate)
+{
+  RandomNumberGenerator rng(0);
+  Array<float> values(ELEMENTS_NUM);
+  for (float &value : values) {
+    value = rng.get_float();
+  }
+  /* A sparse, a random and a dense selection. */
+  for (const float threshold : {0.01f, 0.5f, 0.99f}) {
+    IndexMaskMemory memory;
+    IndexMask mask;
+    {
+      SCOPED_TIMER("from_predicate " + std::to_string(threshold));
+      mask = IndexMask::from_predicate(
+          IndexRange(ELEMENTS_NUM), GrainSize(4096), memory, [&](const int64_t i) {
+            return values[i] < threshold;
+          });
+    }
+    EXPECT_GT(mask.size(), 0);
+  }
+}
+
+TEST(index_mask_performance, ForeachIndex)
+{
+  IndexMaskMemory memory;
+  const IndexMask mask = IndexMask::from_every_nth(3, ELEMENTS_NUM / 3, 0, memory);
+  Array<int> values(ELEMENTS_NUM, 0);
+  {
+    SCOPED_TIMER("foreach_index");
+    mask.foreach_index([&](const int64_t i) { values[i]++; });
+  }
+  {
+    SCOPED_TIMER("foreach_index parallel");
+    mask.foreach_index(GrainSize(4096), [&](const int64_t i) { values[i]++; });
+  }
+  {
+    SCOPED_TIMER("foreach_index_optimized");
+    mask.foreach_index_optimized<int64_t>(GrainSize(4096),
+                                          [&](const int64_t i) { values[i]++; });
+  }
+  EXPECT_EQ(values[0], 3);
+  EXPECT_EQ(values[1], 0);
+}
+
+TEST(index_mask_performance, Gather)
+{
+  RandomNumberGenerator rng(0);
+  Array<float> src(ELEMENTS_NUM);
+  Array<int> indices(ELEMENTS_NUM);
+  for (const int64_t i : src.index_range()) {
+    src[i] = rng.get_float();
+    indices[i] = rng.get_int32(ELEMENTS_NUM);
+  }
+  Array<float> dst(ELEMENTS_NUM);
+  {
+    SCOPED_TIMER("gather random indices");
+    array_utils::gather(src.as_span(), indices.as_span(), dst.as_mutable_span());
+  }
+  {
+    SCOPED_TIMER("copy");
+    array_utils::copy(src.as_span(), dst.as_mutable_span());
+  }
+  EXPECT_EQ(dst[0], src[0]);
+}
+
+TEST(index_mask_performance, OffsetIndices)
+{
+  RandomNumberGenerator rng(0);
+  const int64_t groups_num = ELEMENTS_NUM / 8;
+  Array<int> offset_data(groups_num + 1);
+  for (const int64_t i : IndexRange(groups_num)) {
+    offset_data[i] = 1 + rng.get_int32(14);
+  }
+  OffsetIndices<int> offsets;
+  {
+    SCOPED_TIMER("accumulate_counts_to_offsets");
+    offsets = offset_indices::accumulate_counts_to_offsets(offset_data);
+  }
+  Array<int> group_sizes(groups_num);
+  {
+    SCOPED_TIMER("group sizes");
+    threading::parallel_for(offsets.index_range(), 4096, [&](const IndexRange range) {
+      for (const int64_t i : range) {
+        group_sizes[i] = offsets[i].size();
+      }
+    });
+  }
+  Array<int> indices(offsets.total_size());
+  {
+    SCOPED_TIMER("build_reverse_map");
+    offset_indices::build_reverse_map(offsets, indices);
+  }
+  EXPECT_EQ(indices.last(), groups_num - 1);
+}
+
+}  // namespace blender::index_mask::tests
@@ -0,0 +1,87 @@
+/* SPDX-FileCopyrightText: 2024 Blender Authors
+ *
+ * SPDX-License-Identifier: Apache-2.0 */
+
+#include "testing/testing.h"
+
+#include "BLI_array.hh"
+#include "BLI_kdopbvh.h"
+#include "BLI_kdtree.h"
+#include "BLI_math_vector_types.hh"
+#include "BLI_rand.hh"
+#include "BLI_timeit.hh"
+
+namespace blender::tests {
+
+static constexpr int POINTS_NUM = 1'000'000;
+static constexpr int QUERIES_NUM = 1'000'000;
+
+static Array<float3> random_points(const int num, const uint32_t seed)
+{
+  RandomNumberGenerator rng(seed);
+  Array<float3> points(num);
+  for (float3 &point : points) {
+    point = float3(rng.get_float(), rng.get_float(), rng.get_float());
+  }
+  return points;
+}
+
+TEST(kdtree_performance, FindNearest)
+{
+  const Array<float3> points = random_points(POINTS_NUM, 0);
+  const Array<float3> queries = random_points(QUERIES_NUM, 1);
+
+  KDTree_3d *tree;
+  {
+    SCOPED_TIMER("kdtree build");
+    tree = BLI_kdtree_3d_new(POINTS_NUM);
+    for (const int i : points.index_range()) {
+      BLI_kdtree_3d_insert(tree, i, points[i]);
+    }
+    BLI_kdtree_3d_balance(tree);
+  }
+  int found_num = 0;
+  {
+    SCOPED_TIMER("kdtree find_nearest");
+    for (const float3 &query : queries) {
+      KDTreeNearest_3d nearest;
+      if (BLI_kdtree_3d_find_nearest(tree, query, &nearest) != -1) {
+        found_num++;
+      }
+    }
+  }
+  EXPECT_EQ(found_num, QUERIES_NUM);
+  BLI_kdtree_3d_free(tree);
+}
+
+TEST(bvhtree_performance, FindNearest)
+{
+  const Array<float3> points = random_points(POINTS_NUM, 0);
+  const Array<float3> queries = random_points(QUERIES_NUM, 1);
+
+  BVHTree *tree;
+  {
+    SCOPED_TIMER("bvhtree build");
+    tree = BLI_bvhtree_new(POINTS_NUM, 0.0f, 2, 6);
+    for (const int i : points.index_range()) {
+      BLI_bvhtree_insert(tree, i, points[i], 1);
+    }
+    BLI_bvhtree_balance(tree);
+  }
+  int found_num = 0;
+  {
+    SCOPED_TIMER("bvhtree find_nearest");
+    for (const float3 &query : queries) {
+      BVHTreeNearest nearest;
+      nearest.index = -1;
+      nearest.dist_sq = FLT_MAX;
+      if (BLI_bvhtree_find_nearest(tree, query, &nearest, nullptr, nullptr) != -1) {
+        found_num++;
+      }
+    }
+  }
+  EXPECT_EQ(found_num, QUERIES_NUM);
+  BLI_bvhtree_free(tree);
+}
+
+}  // namespace blender::tests
@@ -243,6 +243,20 @@ TEST(ghash, TextMap)
   str_map_tests(map, "StrMap - DefaultHash");
 }
 
+TEST(ghash, TextMapSimpleSlot)
+{
+  /* Compare to the default #HashedMapSlot, which stores the hash of string keys. */
+  Map<StringRef,
+      int64_t,
+      default_inline_buffer_capacity(sizeof(StringRef) + sizeof(int64_t)),
+      DefaultProbingStrategy,
+      DefaultHash<StringRef>,
+      DefaultEquality<StringRef>,
+      SimpleMapSlot<StringRef, int64_t>>
+      map;
+  str_map_tests(map, "StrMap - SimpleMapSlot");
+}
+
 /* Int: uniform 100M first integers. */
 
 static void int_ghash_tests(GHash *ghash, const char *id, const uint count)
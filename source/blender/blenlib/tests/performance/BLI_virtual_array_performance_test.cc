@@ -0,0 +1,81 @@
+/* SPDX-FileCopyrightText: 2024 Blender Authors
+ *
+ * SPDX-License-Identifier: Apache-2.0 */
+
+#include "testing/testing.h"
+
+#include "BLI_array.hh"
+#include "BLI_rand.hh"
+#include "BLI_timeit.hh"
+#include "BLI_virtual_array.hh"
+
+namespace blender::tests {
+
+static constexpr int64_t ELEMENTS_NUM = 10'000'000;
+
+static float sum_virtual(const VArray<float> &varray)
+{
+  float sum = 0.0f;
+  for (const int64_t i : varray.index_range()) {
+    sum += varray[i];
+  }
+  return sum;
+}
+
+static float sum_devirtualized(const VArray<float> &varray)
+{
+  float sum = 0.0f;
+  devirtualize_varray(varray, [&](const auto values) {
+    for (const int64_t i : IndexRange(varray.size())) {
+      sum += values[i];
+    }
+  });
+  return sum;
+}
+
+static void run_sum_test(const char *name, const VArray<float> &varray)
+{
+  float sum_a, sum_b;
+  {
+    SCOPED_TIMER(std::string(name) + " virtual");
+    sum_a = sum_virtual(varray);
+  }
+  {
+    SCOPED_TIMER(std::string(name) + " devirtualized");
+    sum_b = sum_devirtualized(varray);
+  }
+  EXPECT_EQ(sum_a, sum_b);
+}
+
+TEST(virtual_array_performance, Sum)
+{
+  RandomNumberGenerator rng(0);
+  Array<float> values(ELEMENTS_NUM);
+  for (float &value : values) {
+    value = rng.get_float();
+  }
+  run_sum_test("span", VArray<float>::ForSpan(values));
+  run_sum_test("single", VArray<float>::ForSingle(0.5f, ELEMENTS_NUM));
+  run_sum_test("func", VArray<float>::ForFunc(ELEMENTS_NUM, [](const int64_t i) {
+                 return float(i % 7);
+               }));
+}
+
+TEST(virtual_array_performance, Materialize)
+{
+  const VArray<float> varray = VArray<float>::ForFunc(ELEMENTS_NUM, [](const int64_t i) {
+    return float(i % 7);
+  });
+  Array<float> dst(ELEMENTS_NUM);
+  {
+    SCOPED_TIMER("materialize");
+    varray.materialize(dst);
+  }
+  {
+    SCOPED_TIMER("materialize_to_uninitialized");
+    varray.materialize_to_uninitialized(dst);
+  }
+  EXPECT_EQ(dst[8], 1.0f);
+}
+
+}  // namespace blender::tests
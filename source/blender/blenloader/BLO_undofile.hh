@@ -34,7 +34,11 @@ struct MemFileChunk {
   const char *buf;
   /** Size in bytes. */
   size_t size;
-  /** When true, this chunk doesn't own the memory, it's shared with a previous #MemFileChunk */
+  /**
+   * When true, this chunk is identical to the matching one in the previous step.
+   * \note Chunk buffers are reference counted and shared by all chunks with the same content in
+   * any undo step, so this doesn't relate to memory ownership.
+   */
   bool is_identical;
   /** When true, this chunk is also identical to the one in the next step (used by undo code to
    * detect unchanged IDs).
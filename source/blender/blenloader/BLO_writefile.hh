@@ -60,3 +60,73 @@ extern bool BLO_write_file(Main *mainvar,
 extern bool BLO_write_file_mem(Main *mainvar, MemFile *compare, MemFile *current, int write_flags);
 
 /** \} */
+
+/* -------------------------------------------------------------------- */
+/** \name BLO Write Snapshot API
+ *
+ * Saving in two steps, so that the slow part (compression and disk access) can run in a
+ * background thread while #Main is being edited.
+ * \{ */
+
+/** Opaque in-memory copy of the blend-file data to save. */
+struct BlendFileWriteSnapshot;
+
+/**
+ * Write \a mainvar into memory, to be saved at \a filepath by #BLO_write_file_snapshot_commit.
+ * Must run on the main thread, #Main can be modified once this returns.
+ *
+ * \return The snapshot or null on failure.
+ */
+extern BlendFileWriteSnapshot *BLO_write_file_snapshot(Main *mainvar,
+                                                       const char *filepath,
+                                                       int write_flags,
+                                                       const BlendFileWriteParams *params,
+                                                       ReportList *reports);
+/**
+ * Write the snapshot to disk (including the file history), may run in any thread.
+ * The snapshot can only be committed once, its data is released while writing.
+ *
+ * \param r_progress: Optionally set to the ratio of data written so far.
+ * \return Success.
+ */
+extern bool BLO_write_file_snapshot_commit(BlendFileWriteSnapshot *snapshot,
+                                           float *r_progress,
+                                           ReportList *reports);
+void BLO_write_file_snapshot_free(BlendFileWriteSnapshot *snapshot);
+
+/** \} */
+
+/* -------------------------------------------------------------------- */
+/** \name BLO Write Journal API
+ *
+ * Incremental writing of a blend-file into an append-only journal file, where only data that
+ * changed since the previous write is appended. Used for auto-save.
+ * \{ */
+
+/** Opaque state of a journal between writes. */
+struct BlendFileJournal;
+
+BlendFileJournal *BLO_journal_new();
+void BLO_journal_free(BlendFileJournal *journal);
+
+/**
+ * Write \a mainvar into the journal at \a filepath. Only the data that isn't in the journal
+ * already is appended, a new journal is started when \a filepath was not written with \a journal
+ * before (or when the journal grew too large).
+ *
+ * \note Compression is not supported, \a write_flags must not contain #G_FILE_COMPRESS.
+ */
+extern bool BLO_write_file_journal(Main *mainvar,
+                                   const char *filepath,
+                                   int write_flags,
+                                   ReportList *reports,
+                                   BlendFileJournal *journal);
+/**
+ * Write the blend-file of the last complete write into the journal at \a journal_filepath as a
+ * regular blend-file at \a filepath.
+ */
+extern bool BLO_journal_restore(const char *journal_filepath,
+                                const char *filepath,
+                                ReportList *reports);
+
+/** \} */
@@ -58,6 +58,8 @@
 #include "BLI_map.hh"
 #include "BLI_memarena.h"
 #include "BLI_mempool.h"
+#include "BLI_mmap.h"
+#include "BLI_task.hh"
 #include "BLI_threads.h"
 #include "BLI_time.h"
 
@@ -171,6 +173,19 @@
  */
 #define USE_BHEAD_READ_ON_DEMAND
 
+/**
+ * When the file is memory-mapped, reconstruct delayed blocks directly from the mapping instead of
+ * reading them into a temporary #BHeadN first. This avoids one full copy of all data that needs
+ * DNA reconstruction (typically files saved by older Blender versions), and keeps the pages of
+ * unused data-blocks out of the process' heap entirely.
+ *
+ * \note Windows requires structured exception handling around every access of the mapped memory
+ * to detect IO errors, so this is only used where #BLI_mmap handles errors with a signal handler.
+ */
+#if defined(USE_BHEAD_READ_ON_DEMAND) && !defined(WIN32)
+#  define USE_BHEAD_READ_FROM_MMAP
+#endif
+
 /** Use #GHash for #BHead name-based lookups (speeds up linking). */
 #define USE_GHASH_BHEAD
 
@@ -931,6 +946,29 @@ static BHead *blo_bhead_read_full(FileData *fd, BHead *thisblock)
 }
 #endif /* USE_BHEAD_READ_ON_DEMAND */
 
+#ifdef USE_BHEAD_READ_FROM_MMAP
+/**
+ * Get the address of the delayed data of \a thisblock inside the memory-mapped file.
+ *
+ * \return null when the file isn't memory-mapped or the block is out of bounds,
+ * in this case the data has to be read with #blo_bhead_read_data.
+ */
+static const void *blo_bhead_mmap_data(FileData *fd, BHead *thisblock)
+{
+  if (fd->mmap_file == nullptr) {
+    return nullptr;
+  }
+  BHeadN *new_bhead = BHEADN_FROM_BHEAD(thisblock);
+  BLI_assert(new_bhead->has_data == false && new_bhead->file_offset != 0);
+  if (size_t(new_bhead->file_offset) + size_t(thisblock->len) >
+      BLI_mmap_get_length(fd->mmap_file))
+  {
+    return nullptr;
+  }
+  return POINTER_OFFSET(BLI_mmap_get_pointer(fd->mmap_file), new_bhead->file_offset);
+}
+#endif /* USE_BHEAD_READ_FROM_MMAP */
+
 const char *blo_bhead_id_name(const FileData *fd, const BHead *bhead)
 {
   return (const char *)POINTER_OFFSET(bhead, sizeof(*bhead) + fd->id_name_offset);
@@ -1246,6 +1284,7 @@ static FileData *blo_filedata_from_file_descriptor(const char *filepath,
 
   FileData *fd = filedata_new(reports);
   fd->file = file;
+  fd->mmap_file = BLI_filereader_mmap_file(file);
 
   return fd;
 }
@@ -1821,17 +1860,31 @@ static void *read_struct(FileData *fd, BHead *bh, const char *blockname, const i
     if (fd->compflags[bh->SDNAnr] != SDNA_CMP_REMOVED) {
       const char *alloc_name = get_alloc_name(fd, bh, blockname, id_type_index);
       if (fd->compflags[bh->SDNAnr] == SDNA_CMP_NOT_EQUAL) {
+        const void *data = (bh + 1);
 #ifdef USE_BHEAD_READ_ON_DEMAND
         if (BHEADN_FROM_BHEAD(bh)->has_data == false) {
-          bh = blo_bhead_read_full(fd, bh);
-          if (UNLIKELY(bh == nullptr)) {
-            fd->flags &= ~FD_FLAGS_FILE_OK;
-            return nullptr;
+#  ifdef USE_BHEAD_READ_FROM_MMAP
+          data = blo_bhead_mmap_data(fd, bh);
+          if (data == nullptr)
+#  endif
+          {
+            bh = blo_bhead_read_full(fd, bh);
+            if (UNLIKELY(bh == nullptr)) {
+              fd->flags &= ~FD_FLAGS_FILE_OK;
+              return nullptr;
+            }
+            data = (bh + 1);
           }
         }
 #endif
-        temp = DNA_struct_reconstruct(
-            fd->reconstruct_info, bh->SDNAnr, bh->nr, (bh + 1), alloc_name);
+        temp = DNA_struct_reconstruct(fd->reconstruct_info, bh->SDNAnr, bh->nr, data, alloc_name);
+#ifdef USE_BHEAD_READ_FROM_MMAP
+        /* Reading from the mapping may have failed, the data is zeroed in that case. */
+        if (UNLIKELY(fd->mmap_file && BLI_mmap_any_io_error(fd->mmap_file))) {
+          fd->flags &= ~FD_FLAGS_FILE_OK;
+          MEM_SAFE_FREE(temp);
+        }
+#endif
       }
       else {
         /* SDNA_CMP_EQUAL */
@@ -2463,12 +2516,133 @@ static bool direct_link_id(FileData *fd, Main *main, const int tag, ID *id, ID *
   return success;
 }
 
+#ifdef USE_BHEAD_READ_FROM_MMAP
+/**
+ * Thread-safe version of #read_struct, only valid for files read from a memory-mapped file
+ * without endian switching (see #read_data_into_datamap_threaded).
+ *
+ * \param data: The address of the block's data, either in the mapping or in the #BHeadN.
+ */
+static void *read_struct_threadsafe(FileData *fd,
+                                    const BHead *bh,
+                                    const void *data,
+                                    const char *alloc_name)
+{
+  if (bh->len == 0 || fd->compflags[bh->SDNAnr] == SDNA_CMP_REMOVED) {
+    return nullptr;
+  }
+  if (fd->compflags[bh->SDNAnr] == SDNA_CMP_NOT_EQUAL) {
+    return DNA_struct_reconstruct(fd->reconstruct_info, bh->SDNAnr, bh->nr, data, alloc_name);
+  }
+  /* SDNA_CMP_EQUAL */
+  const int alignment = DNA_struct_alignment(fd->filesdna, bh->SDNAnr);
+  void *temp = MEM_mallocN_aligned(bh->len, alignment, alloc_name);
+  memcpy(temp, data, bh->len);
+  return temp;
+}
+
+/**
+ * Same as #read_data_into_datamap, but decodes the data blocks of the data-block in parallel.
+ * This only reads from the memory mapping, reading the #BHead list and filling the datamap (which
+ * are not thread-safe) remain serial.
+ *
+ * \return false when the blocks can't be decoded in parallel, in that case nothing was read.
+ */
+static bool read_data_into_datamap_threaded(FileData *fd,
+                                            BHead **r_bhead,
+                                            const char *allocname,
+                                            const int id_type_index)
+{
+  using namespace blender;
+  /* Below this size, the overhead of threading isn't worth it. */
+  constexpr int64_t grain_size = 256 * 1024;
+
+  if (fd->mmap_file == nullptr || (fd->flags & FD_FLAGS_SWITCH_ENDIAN)) {
+    return false;
+  }
+
+  Vector<BHead *, 32> data_bheads;
+  int64_t data_size = 0;
+  for (BHead *bhead = blo_bhead_next(fd, *r_bhead); bhead && bhead->code == BLO_CODE_DATA;
+       bhead = blo_bhead_next(fd, bhead))
+  {
+    data_bheads.append(bhead);
+    data_size += bhead->len;
+  }
+  if (data_size < grain_size * 2) {
+    return false;
+  }
+
+  /* Gather everything that requires access to non thread-safe #FileData members first. */
+  Array<const void *> data_ptrs(data_bheads.size());
+  Array<const char *> alloc_names(data_bheads.size());
+  for (const int64_t i : data_bheads.index_range()) {
+    BHead *bh = data_bheads[i];
+    data_ptrs[i] = BHEADN_FROM_BHEAD(bh)->has_data ? (bh + 1) : blo_bhead_mmap_data(fd, bh);
+    if (bh->len != 0 && data_ptrs[i] == nullptr) {
+      /* Let the regular code-path handle (and report) invalid blocks. */
+      return false;
+    }
+    alloc_names[i] = (bh->len != 0 && fd->compflags[bh->SDNAnr] != SDNA_CMP_REMOVED) ?
+                         get_alloc_name(fd, bh, allocname, id_type_index) :
+                         nullptr;
+  }
+
+  Array<void *> data_blocks(data_bheads.size());
+  threading::parallel_for(
+      data_bheads.index_range(),
+      grain_size,
+      [&](const IndexRange range) {
+        for (const int64_t i : range) {
+          data_blocks[i] = read_struct_threadsafe(
+              fd, data_bheads[i], data_ptrs[i], alloc_names[i]);
+        }
+      },
+      threading::individual_task_sizes([&](const int64_t i) { return data_bheads[i]->len; },
+                                       data_size));
+
+  /* Reading from the mapping may have failed, the data is zeroed in that case. */
+  const bool io_error = BLI_mmap_any_io_error(fd->mmap_file);
+  if (UNLIKELY(io_error)) {
+    fd->flags &= ~FD_FLAGS_FILE_OK;
+  }
+
+  for (const int64_t i : data_bheads.index_range()) {
+    void *data = data_blocks[i];
+    if (data == nullptr) {
+      continue;
+    }
+    if (io_error) {
+      MEM_freeN(data);
+      continue;
+    }
+    const BHead *bh = data_bheads[i];
+    const bool is_new = oldnewmap_insert(fd->datamap, bh->old, data, 0);
+    if (!is_new) {
+      CLOG_ERROR(&LOG,
+                 "Blendfile corruption: Invalid, or multiple `bhead` with same old address "
+                 "value (%p) for a given ID.",
+                 bh->old);
+    }
+  }
+
+  *r_bhead = blo_bhead_next(fd, data_bheads.last());
+  return true;
+}
+#endif /* USE_BHEAD_READ_FROM_MMAP */
+
 /* Read all data associated with a datablock into datamap. */
 static BHead *read_data_into_datamap(FileData *fd,
                                      BHead *bhead,
                                      const char *allocname,
                                      const int id_type_index)
 {
+#ifdef USE_BHEAD_READ_FROM_MMAP
+  if (read_data_into_datamap_threaded(fd, &bhead, allocname, id_type_index)) {
+    return bhead;
+  }
+#endif
+
   bhead = blo_bhead_next(fd, bhead);
 
   while (bhead && bhead->code == BLO_CODE_DATA) {
@@ -28,6 +28,7 @@ struct BlendFileReadParams;
 struct BlendFileReadReport;
 struct BLOCacheStorage;
 struct BHeadSort;
+struct BLI_mmap_file;
 struct DNA_ReconstructInfo;
 struct IDNameLib_Map;
 struct Key;
@@ -65,6 +66,11 @@ struct FileData {
   bool is_eof;
 
   FileReader *file;
+  /**
+   * Memory-mapped file backing #file (owned by it), if any.
+   * Allows reconstructing delayed #BHead data directly from the mapping.
+   */
+  BLI_mmap_file *mmap_file;
 
   /** Whether we are undoing (< 0) or redoing (> 0), used to choose which 'unchanged' flag to use
    * to detect unchanged data from memfile. */
@@ -26,6 +26,7 @@
 
 #include "BLI_blenlib.h"
 #include "BLI_implicit_sharing.hh"
+#include "BLI_threads.h"
 
 #include "BLO_readfile.hh"
 #include "BLO_undofile.hh"
@@ -34,16 +35,120 @@
 #include "BKE_main.hh"
 #include "BKE_undo_system.hh"
 
+#include <xxhash.h>
+
 #include "BLI_strict_flags.h" /* Keep last. */
 
+/* -------------------------------------------------------------------- */
+/** \name Shared Chunk Buffers
+ *
+ * The buffers of #MemFileChunk are reference counted and de-duplicated by their content across
+ * all undo steps, so that going back to a previous state (or toggling between two states) does
+ * not store the same data again, even when it differs from the immediately previous step.
+ *
+ * Each buffer is allocated with a #MemFileChunkBuffer header directly preceding the chunk data.
+ * \{ */
+
+struct MemFileChunkBuffer {
+  uint64_t content_hash;
+  size_t size;
+  /** Number of #MemFileChunk using this buffer. */
+  int users;
+  /** Whether this buffer is in #chunk_buffers_by_content (not the case on hash collisions). */
+  bool is_indexed;
+};
+
+struct MemFileChunkBufferKey {
+  uint64_t content_hash;
+  size_t size;
+
+  uint64_t hash() const
+  {
+    return content_hash;
+  }
+
+  friend bool operator==(const MemFileChunkBufferKey &a, const MemFileChunkBufferKey &b)
+  {
+    return a.content_hash == b.content_hash && a.size == b.size;
+  }
+};
+
+/** All chunk buffers of all undo steps, by content. Only accessed from the main thread. */
+static blender::Map<MemFileChunkBufferKey, MemFileChunkBuffer *> &chunk_buffers_by_content()
+{
+  static blender::Map<MemFileChunkBufferKey, MemFileChunkBuffer *> map;
+  return map;
+}
+
+static MemFileChunkBuffer *chunk_buffer_from_data(const char *buf)
+{
+  return reinterpret_cast<MemFileChunkBuffer *>(const_cast<char *>(buf)) - 1;
+}
+
+/**
+ * Get a buffer with the given content, either an existing one or a new copy.
+ * \param r_is_new: Whether the buffer was allocated by this call.
+ */
+static const char *chunk_buffer_ensure(const char *buf, const size_t size, bool *r_is_new)
+{
+  BLI_assert(BLI_thread_is_main());
+  blender::Map<MemFileChunkBufferKey, MemFileChunkBuffer *> &map = chunk_buffers_by_content();
+
+  const MemFileChunkBufferKey key{XXH3_64bits(buf, size), size};
+  if (MemFileChunkBuffer *existing = map.lookup_default(key, nullptr)) {
+    const char *existing_data = reinterpret_cast<const char *>(existing + 1);
+    if (memcmp(existing_data, buf, size) == 0) {
+      existing->users++;
+      *r_is_new = false;
+      return existing_data;
+    }
+  }
+
+  MemFileChunkBuffer *chunk_buffer = static_cast<MemFileChunkBuffer *>(
+      MEM_mallocN(sizeof(MemFileChunkBuffer) + size, "Chunk buffer"));
+  chunk_buffer->content_hash = key.content_hash;
+  chunk_buffer->size = size;
+  chunk_buffer->users = 1;
+  chunk_buffer->is_indexed = map.add(key, chunk_buffer);
+
+  char *data = reinterpret_cast<char *>(chunk_buffer + 1);
+  memcpy(data, buf, size);
+  *r_is_new = true;
+  return data;
+}
+
+static void chunk_buffer_add_user(const char *buf)
+{
+  chunk_buffer_from_data(buf)->users++;
+}
+
+static void chunk_buffer_remove_user(const char *buf)
+{
+  BLI_assert(BLI_thread_is_main());
+  MemFileChunkBuffer *chunk_buffer = chunk_buffer_from_data(buf);
+  BLI_assert(chunk_buffer->users > 0);
+  if (--chunk_buffer->users > 0) {
+    return;
+  }
+  if (chunk_buffer->is_indexed) {
+    blender::Map<MemFileChunkBufferKey, MemFileChunkBuffer *> &map = chunk_buffers_by_content();
+    map.remove({chunk_buffer->content_hash, chunk_buffer->size});
+    if (map.is_empty()) {
+      /* Don't keep memory around once all undo steps are freed. */
+      map.clear_and_shrink();
+    }
+  }
+  MEM_freeN(chunk_buffer);
+}
+
+/** \} */
+
 /* **************** support for memory-write, for undo buffers *************** */
 
 void BLO_memfile_free(MemFile *memfile)
 {
   while (MemFileChunk *chunk = static_cast<MemFileChunk *>(BLI_pophead(&memfile->chunks))) {
-    if (chunk->is_identical == false) {
-      MEM_freeN((void *)chunk->buf);
-    }
+    chunk_buffer_remove_user(chunk->buf);
     MEM_freeN(chunk);
   }
   MEM_delete(memfile->shared_storage);
@@ -61,29 +166,26 @@ MemFileSharedStorage::~MemFileSharedStorage()
 
 void BLO_memfile_merge(MemFile *first, MemFile *second)
 {
-  /* We use this mapping to store the memory buffers from second memfile chunks which are not owned
-   * by it (i.e. shared with some previous memory steps). */
+  /* We use this mapping to store the memory buffers from second memfile chunks which are
+   * identical to the ones of a previous memory step. */
   blender::Map<const char *, MemFileChunk *> buffer_to_second_memchunk;
 
-  /* First, detect all memchunks in second memfile that are not owned by it. */
+  /* First, detect all memchunks in second memfile that are identical to the previous step. */
   LISTBASE_FOREACH (MemFileChunk *, sc, &second->chunks) {
     if (sc->is_identical) {
       buffer_to_second_memchunk.add(sc->buf, sc);
     }
   }
 
-  /* Now, check all chunks from first memfile (the one we are removing), and if a memchunk owned by
-   * it is also used by the second memfile, transfer the ownership. */
+  /* Now, check all chunks from first memfile (the one we are removing). If a memchunk that
+   * changed in it is identical in the second memfile, the second one now differs from its new
+   * previous step. Buffers are reference counted, so their memory is kept as long as needed. */
   LISTBASE_FOREACH (MemFileChunk *, fc, &first->chunks) {
     if (!fc->is_identical) {
       if (MemFileChunk *sc = buffer_to_second_memchunk.lookup_default(fc->buf, nullptr)) {
         BLI_assert(sc->is_identical);
         sc->is_identical = false;
-        fc->is_identical = true;
       }
-      /* Note that if the second memfile does not use that chunk, we assume that the first one
-       * fully owns it without sharing it with any other memfile, and hence it should be freed with
-       * it. */
     }
   }
 
@@ -153,17 +255,19 @@ void BLO_memfile_chunk_add(MemFileWriteData *mem_data, const char *buf, size_t s
         curchunk->buf = compchunk->buf;
         curchunk->is_identical = true;
         compchunk->is_identical_future = true;
+        chunk_buffer_add_user(curchunk->buf);
       }
     }
     *compchunk_step = static_cast<MemFileChunk *>(compchunk->next);
   }
 
-  /* not equal... */
+  /* Not equal to the previous step, but the same content may still be stored by another step. */
   if (curchunk->buf == nullptr) {
-    char *buf_new = static_cast<char *>(MEM_mallocN(size, "Chunk buffer"));
-    memcpy(buf_new, buf, size);
-    curchunk->buf = buf_new;
-    memfile->size += size;
+    bool is_new;
+    curchunk->buf = chunk_buffer_ensure(buf, size, &is_new);
+    if (is_new) {
+      memfile->size += size;
+    }
   }
 }
 
@@ -130,6 +130,7 @@
 
 #include "readfile.hh"
 
+#include <xxhash.h>
 #include <zstd.h>
 
 /* Make preferences read-only. */
@@ -170,6 +171,11 @@ class WriteWrap {
 
   /** Buffer output (we only want when output isn't already buffered). */
   bool use_buf = true;
+  /**
+   * Flush the buffer after every ID (like for undo), so that the data of unchanged IDs results in
+   * identical #write calls.
+   */
+  bool use_flush_per_id = false;
 };
 
 class RawWriteWrap : public WriteWrap {
@@ -680,6 +686,9 @@ static void mywrite_id_end(WriteData *wd, ID * /*id*/)
     mywrite_flush(wd);
     wd->mem.current_id_session_uid = MAIN_ID_SESSION_UID_UNSET;
   }
+  else if (wd->ww->use_flush_per_id) {
+    mywrite_flush(wd);
+  }
 
   wd->validation_data.per_id_addresses_set.clear();
   wd->per_id_written_shared_addresses.clear();
@@ -1589,49 +1598,27 @@ static void write_file_main_validate_post(Main *bmain, ReportList *reports)
   }
 }
 
-static bool BLO_write_file_impl(Main *mainvar,
-                                const char *filepath,
-                                const int write_flags,
-                                const BlendFileWriteParams *params,
-                                ReportList *reports,
-                                WriteWrap &ww)
+/**
+ * Write \a mainvar with \a ww (already opened), remapping paths as needed for \a filepath.
+ * \return True on error (like #write_file_handle).
+ */
+static bool write_file_handle_remapped(Main *mainvar,
+                                       const char *filepath,
+                                       const int write_flags,
+                                       const BlendFileWriteParams *params,
+                                       WriteWrap &ww)
 {
-  BLI_assert(!BLI_path_is_rel(filepath));
-  BLI_assert(BLI_path_is_abs_from_cwd(filepath));
-
-  char tempname[FILE_MAX + 1];
-
   eBLO_WritePathRemap remap_mode = params->remap_mode;
-  const bool use_save_versions = params->use_save_versions;
   const bool use_save_as_copy = params->use_save_as_copy;
   const bool use_userdef = params->use_userdef;
   const BlendThumbnail *thumb = params->thumb;
   const bool relbase_valid = (mainvar->filepath[0] != '\0');
 
-  /* Extra protection: Never save a non asset file as asset file. Otherwise a normal file is turned
-   * into an asset file, which can result in data loss because the asset system will allow editing
-   * this file from the UI, regenerating its content with just the asset and it dependencies. */
-  if ((write_flags & G_FILE_ASSET_EDIT_FILE) && !mainvar->is_asset_edit_file) {
-    BKE_reportf(reports, RPT_ERROR, "Cannot save normal file (%s) as asset system file", tempname);
-    return false;
-  }
-
   /* Path backup/restore. */
   void *path_list_backup = nullptr;
   const eBPathForeachFlag path_list_flag = (BKE_BPATH_FOREACH_PATH_SKIP_LINKED |
                                             BKE_BPATH_FOREACH_PATH_SKIP_MULTIFILE);
 
-  write_file_main_validate_pre(mainvar, reports);
-
-  /* Open temporary file, so we preserve the original in case we crash. */
-  SNPRINTF(tempname, "%s@", filepath);
-
-  if (ww.open(tempname) == false) {
-    BKE_reportf(
-        reports, RPT_ERROR, "Cannot open file %s for writing: %s", tempname, strerror(errno));
-    return false;
-  }
-
   if (remap_mode == BLO_WRITE_PATH_REMAP_ABSOLUTE) {
     /* Paths will already be absolute, no remapping to do. */
     if (relbase_valid == false) {
@@ -1719,20 +1706,22 @@ static bool BLO_write_file_impl(Main *mainvar,
   const bool err = write_file_handle(
       mainvar, &ww, nullptr, nullptr, write_flags, use_userdef, thumb);
 
-  ww.close();
-
   if (UNLIKELY(path_list_backup)) {
     BKE_bpath_list_restore(mainvar, path_list_flag, path_list_backup);
     BKE_bpath_list_free(path_list_backup);
   }
 
-  if (err) {
-    BKE_report(reports, RPT_ERROR, strerror(errno));
-    remove(tempname);
-
-    return false;
-  }
+  return err;
+}
 
+/**
+ * Move the successfully written \a tempname to \a filepath, doing the file history first.
+ */
+static bool write_file_move_into_place(const char *tempname,
+                                       const char *filepath,
+                                       const bool use_save_versions,
+                                       ReportList *reports)
+{
   /* File save to temporary file was successful, now do reverse file history
    * (move `.blend1` -> `.blend2`, `.blend` -> `.blend1` .. etc). */
   if (use_save_versions) {
@@ -1747,6 +1736,55 @@ static bool BLO_write_file_impl(Main *mainvar,
     return false;
   }
 
+  return true;
+}
+
+static bool BLO_write_file_impl(Main *mainvar,
+                                const char *filepath,
+                                const int write_flags,
+                                const BlendFileWriteParams *params,
+                                ReportList *reports,
+                                WriteWrap &ww)
+{
+  BLI_assert(!BLI_path_is_rel(filepath));
+  BLI_assert(BLI_path_is_abs_from_cwd(filepath));
+
+  char tempname[FILE_MAX + 1];
+
+  /* Extra protection: Never save a non asset file as asset file. Otherwise a normal file is turned
+   * into an asset file, which can result in data loss because the asset system will allow editing
+   * this file from the UI, regenerating its content with just the asset and it dependencies. */
+  if ((write_flags & G_FILE_ASSET_EDIT_FILE) && !mainvar->is_asset_edit_file) {
+    BKE_reportf(reports, RPT_ERROR, "Cannot save normal file (%s) as asset system file", filepath);
+    return false;
+  }
+
+  write_file_main_validate_pre(mainvar, reports);
+
+  /* Open temporary file, so we preserve the original in case we crash. */
+  SNPRINTF(tempname, "%s@", filepath);
+
+  if (ww.open(tempname) == false) {
+    BKE_reportf(
+        reports, RPT_ERROR, "Cannot open file %s for writing: %s", tempname, strerror(errno));
+    return false;
+  }
+
+  const bool err = write_file_handle_remapped(mainvar, filepath, write_flags, params, ww);
+
+  ww.close();
+
+  if (err) {
+    BKE_report(reports, RPT_ERROR, strerror(errno));
+    remove(tempname);
+
+    return false;
+  }
+
+  if (!write_file_move_into_place(tempname, filepath, params->use_save_versions, reports)) {
+    return false;
+  }
+
   write_file_main_validate_post(mainvar, reports);
 
   return true;
@@ -1754,6 +1792,467 @@ static bool BLO_write_file_impl(Main *mainvar,
 
 /** \} */
 
+/* -------------------------------------------------------------------- */
+/** \name Snapshot Writing
+ *
+ * Saving is split in two steps: the blend-file data is first written into memory on the main
+ * thread (#BLO_write_file_snapshot), then compressed and written to disk without accessing
+ * #Main any more (#BLO_write_file_snapshot_commit), so that the second step can run in the
+ * background while #Main is being edited.
+ *
+ * The snapshot keeps the data as flushed by #mywrite, so that compressed files get the same
+ * frames as when writing them directly.
+ * \{ */
+
+struct BlendFileWriteSnapshotChunk {
+  void *data;
+  size_t size;
+};
+
+struct BlendFileWriteSnapshot {
+  char filepath[FILE_MAX];
+  int write_flags;
+  bool use_save_versions;
+
+  blender::Vector<BlendFileWriteSnapshotChunk> chunks;
+  size_t size = 0;
+
+  ~BlendFileWriteSnapshot()
+  {
+    for (const BlendFileWriteSnapshotChunk &chunk : chunks) {
+      MEM_SAFE_FREE(chunk.data);
+    }
+  }
+};
+
+class SnapshotWriteWrap : public WriteWrap {
+  BlendFileWriteSnapshot &snapshot_;
+
+ public:
+  SnapshotWriteWrap(BlendFileWriteSnapshot &snapshot) : snapshot_(snapshot) {}
+
+  bool open(const char * /*filepath*/) override
+  {
+    return true;
+  }
+  bool close() override
+  {
+    return true;
+  }
+  bool write(const void *buf, size_t buf_len) override
+  {
+    void *data = MEM_mallocN(buf_len, "BlendFileWriteSnapshotChunk");
+    memcpy(data, buf, buf_len);
+    snapshot_.chunks.append({data, buf_len});
+    snapshot_.size += buf_len;
+    return true;
+  }
+};
+
+BlendFileWriteSnapshot *BLO_write_file_snapshot(Main *mainvar,
+                                                const char *filepath,
+                                                const int write_flags,
+                                                const BlendFileWriteParams *params,
+                                                ReportList *reports)
+{
+  BLI_assert(!BLI_path_is_rel(filepath));
+  BLI_assert(BLI_path_is_abs_from_cwd(filepath));
+
+  /* See #BLO_write_file_impl. */
+  if ((write_flags & G_FILE_ASSET_EDIT_FILE) && !mainvar->is_asset_edit_file) {
+    BKE_reportf(reports, RPT_ERROR, "Cannot save normal file (%s) as asset system file", filepath);
+    return nullptr;
+  }
+
+  write_file_main_validate_pre(mainvar, reports);
+
+  BlendFileWriteSnapshot *snapshot = MEM_new<BlendFileWriteSnapshot>(__func__);
+  STRNCPY(snapshot->filepath, filepath);
+  snapshot->write_flags = write_flags;
+  snapshot->use_save_versions = params->use_save_versions;
+
+  SnapshotWriteWrap snapshot_wrap(*snapshot);
+  if (write_file_handle_remapped(mainvar, filepath, write_flags, params, snapshot_wrap)) {
+    BKE_report(reports, RPT_ERROR, "Cannot collect the data to save");
+    MEM_delete(snapshot);
+    return nullptr;
+  }
+
+  write_file_main_validate_post(mainvar, reports);
+
+  return snapshot;
+}
+
+bool BLO_write_file_snapshot_commit(BlendFileWriteSnapshot *snapshot,
+                                    float *r_progress,
+                                    ReportList *reports)
+{
+  char tempname[FILE_MAX + 1];
+  SNPRINTF(tempname, "%s@", snapshot->filepath);
+
+  RawWriteWrap raw_wrap;
+  ZstdWriteWrap zstd_wrap(raw_wrap);
+  WriteWrap &ww = (snapshot->write_flags & G_FILE_COMPRESS) ? static_cast<WriteWrap &>(zstd_wrap) :
+                                                              raw_wrap;
+
+  if (ww.open(tempname) == false) {
+    BKE_reportf(
+        reports, RPT_ERROR, "Cannot open file %s for writing: %s", tempname, strerror(errno));
+    return false;
+  }
+
+  bool err = false;
+  size_t written_size = 0;
+  for (BlendFileWriteSnapshotChunk &chunk : snapshot->chunks) {
+    err = !ww.write(chunk.data, chunk.size);
+    /* Release the memory as soon as possible, the snapshot can only be committed once. */
+    MEM_SAFE_FREE(chunk.data);
+    if (err) {
+      break;
+    }
+    written_size += chunk.size;
+    if (r_progress) {
+      *r_progress = float(double(written_size) / double(max_zz(snapshot->size, 1)));
+    }
+  }
+
+  err |= !ww.close();
+
+  if (err) {
+    BKE_report(reports, RPT_ERROR, strerror(errno));
+    remove(tempname);
+    return false;
+  }
+
+  return write_file_move_into_place(
+      tempname, snapshot->filepath, snapshot->use_save_versions, reports);
+}
+
+void BLO_write_file_snapshot_free(BlendFileWriteSnapshot *snapshot)
+{
+  MEM_delete(snapshot);
+}
+
+/** \} */
+
+/* -------------------------------------------------------------------- */
+/** \name Journal Writing
+ *
+ * A journal is an append-only file that stores the blend-file data written by successive
+ * #BLO_write_file_journal calls. The data is stored in chunks (one or more per ID, see
+ * #WriteWrap::use_flush_per_id) that are de-duplicated by their content: a write only appends the
+ * chunks that are not in the journal yet, followed by an index listing the chunks of the whole
+ * blend-file. The cost of a write on disk is therefore proportional to the changed data.
+ *
+ * Chunks are identified by a 128-bit hash of their content and their size. Chunks with the same
+ * key are considered equal, so the journal never has to be read back while writing.
+ *
+ * The last complete index is turned back into a regular blend-file by #BLO_journal_restore.
+ *
+ * \note Journals are meant to be restored on the machine that wrote them, so all values are
+ * written in native byte order.
+ * \{ */
+
+#define JOURNAL_MAGIC "BLENDJNL"
+#define JOURNAL_VERSION 1
+
+/** A chunk of data: #JournalChunkKey, followed by the chunk content. */
+#define JOURNAL_CODE_DATA BLEND_MAKE_ID('D', 'A', 'T', 'A')
+/** An index: number of chunks (uint64_t), followed by the #JournalChunkKey of every chunk. */
+#define JOURNAL_CODE_INDEX BLEND_MAKE_ID('I', 'N', 'D', 'X')
+
+/** Never restart journals smaller than this, restarting is as expensive as a regular save. */
+#define JOURNAL_RESTART_MIN_SIZE (64 * 1024 * 1024)
+
+struct JournalChunkKey {
+  uint64_t content_hash_low;
+  uint64_t content_hash_high;
+  uint64_t size;
+
+  uint64_t hash() const
+  {
+    return content_hash_low;
+  }
+
+  friend bool operator==(const JournalChunkKey &a, const JournalChunkKey &b)
+  {
+    return a.content_hash_low == b.content_hash_low &&
+           a.content_hash_high == b.content_hash_high && a.size == b.size;
+  }
+};
+
+struct BlendFileJournal {
+  /** The journal file the chunks are stored in. */
+  char filepath[FILE_MAX] = "";
+  /** All chunks stored in the journal file. */
+  blender::Set<JournalChunkKey> chunks;
+  /** Size of the journal file. */
+  size_t file_size = 0;
+  /** Size of the blend-file referenced by the last index. */
+  size_t data_size = 0;
+};
+
+class JournalWriteWrap : public WriteWrap {
+  BlendFileJournal &journal_;
+  int file_handle_ = -1;
+  blender::Vector<JournalChunkKey> index_;
+  bool write_error_ = false;
+
+ public:
+  JournalWriteWrap(BlendFileJournal &journal) : journal_(journal)
+  {
+    use_flush_per_id = true;
+  }
+
+  bool open(const char *filepath) override;
+  bool close() override;
+  bool write(const void *buf, size_t buf_len) override;
+
+ private:
+  bool write_raw(const void *buf, size_t buf_len);
+};
+
+bool JournalWriteWrap::open(const char *filepath)
+{
+  /* Start a new journal when the file doesn't match what was written before, or when it grew too
+   * much compared to the data it stores (when the same data keeps changing). */
+  const bool use_append = !journal_.chunks.is_empty() &&
+                          BLI_path_cmp(journal_.filepath, filepath) == 0 &&
+                          BLI_exists(filepath) && BLI_file_size(filepath) == journal_.file_size &&
+                          journal_.file_size <=
+                              std::max<size_t>(journal_.data_size * 3, JOURNAL_RESTART_MIN_SIZE);
+  if (!use_append) {
+    STRNCPY(journal_.filepath, filepath);
+    journal_.chunks.clear();
+    journal_.file_size = 0;
+    journal_.data_size = 0;
+  }
+
+  file_handle_ = BLI_open(
+      filepath, O_BINARY | O_WRONLY | O_CREAT | (use_append ? O_APPEND : O_TRUNC), 0666);
+  if (file_handle_ == -1) {
+    journal_.chunks.clear();
+    return false;
+  }
+
+  if (!use_append) {
+    const uint32_t version = JOURNAL_VERSION;
+    if (!write_raw(JOURNAL_MAGIC, 8) || !write_raw(&version, sizeof(version))) {
+      ::close(file_handle_);
+      journal_.chunks.clear();
+      return false;
+    }
+  }
+  return true;
+}
+
+bool JournalWriteWrap::write_raw(const void *buf, size_t buf_len)
+{
+  if (write_error_) {
+    return false;
+  }
+  if (::write(file_handle_, buf, buf_len) != buf_len) {
+    write_error_ = true;
+    return false;
+  }
+  journal_.file_size += buf_len;
+  return true;
+}
+
+bool JournalWriteWrap::write(const void *buf, size_t buf_len)
+{
+  const XXH128_hash_t content_hash = XXH3_128bits(buf, buf_len);
+  const JournalChunkKey key{content_hash.low64, content_hash.high64, buf_len};
+  index_.append(key);
+  if (!journal_.chunks.add(key)) {
+    /* Unchanged data. */
+    return true;
+  }
+  const int32_t code = JOURNAL_CODE_DATA;
+  return write_raw(&code, sizeof(code)) && write_raw(&key, sizeof(key)) &&
+         write_raw(buf, buf_len);
+}
+
+bool JournalWriteWrap::close()
+{
+  /* The index is written last, an interrupted write keeps the previous index as the last
+   * complete one. */
+  const int32_t code = JOURNAL_CODE_INDEX;
+  const uint64_t chunks_num = uint64_t(index_.size());
+  bool success = write_raw(&code, sizeof(code)) && write_raw(&chunks_num, sizeof(chunks_num)) &&
+                 write_raw(index_.data(), index_.as_span().size_in_bytes());
+  success &= (::close(file_handle_) != -1);
+
+  if (success) {
+    journal_.data_size = 0;
+    for (const JournalChunkKey &key : index_) {
+      journal_.data_size += key.size;
+    }
+  }
+  else {
+    /* The chunks written by this call may be incomplete, start over with the next write. */
+    journal_.chunks.clear();
+  }
+  index_.clear();
+  return success;
+}
+
+BlendFileJournal *BLO_journal_new()
+{
+  return MEM_new<BlendFileJournal>(__func__);
+}
+
+void BLO_journal_free(BlendFileJournal *journal)
+{
+  MEM_delete(journal);
+}
+
+bool BLO_write_file_journal(Main *mainvar,
+                            const char *filepath,
+                            const int write_flags,
+                            ReportList *reports,
+                            BlendFileJournal *journal)
+{
+  BLI_assert(!BLI_path_is_rel(filepath));
+  BLI_assert((write_flags & G_FILE_COMPRESS) == 0);
+
+  JournalWriteWrap journal_wrap(*journal);
+
+  write_file_main_validate_pre(mainvar, reports);
+
+  if (journal_wrap.open(filepath) == false) {
+    BKE_reportf(
+        reports, RPT_ERROR, "Cannot open file %s for writing: %s", filepath, strerror(errno));
+    return false;
+  }
+
+  const bool err = write_file_handle(
+      mainvar, &journal_wrap, nullptr, nullptr, write_flags, false, nullptr);
+
+  if (!journal_wrap.close() || err) {
+    BKE_report(reports, RPT_ERROR, strerror(errno));
+    return false;
+  }
+
+  write_file_main_validate_post(mainvar, reports);
+
+  return true;
+}
+
+bool BLO_journal_restore(const char *journal_filepath, const char *filepath, ReportList *reports)
+{
+  const int file = BLI_open(journal_filepath, O_BINARY | O_RDONLY, 0);
+  if (file == -1) {
+    BKE_reportf(reports,
+                RPT_ERROR,
+                "Cannot open journal %s for reading: %s",
+                journal_filepath,
+                strerror(errno));
+    return false;
+  }
+  FileReader *reader = BLI_filereader_new_mmap(file);
+  if (reader == nullptr) {
+    reader = BLI_filereader_new_file(file);
+  }
+
+  const off64_t file_size = reader->seek(reader, 0, SEEK_END);
+  reader->seek(reader, 0, SEEK_SET);
+
+  char magic[8];
+  uint32_t version;
+  if (reader->read(reader, magic, sizeof(magic)) != sizeof(magic) ||
+      memcmp(magic, JOURNAL_MAGIC, sizeof(magic)) != 0 ||
+      reader->read(reader, &version, sizeof(version)) != sizeof(version) ||
+      version != JOURNAL_VERSION)
+  {
+    BKE_reportf(reports, RPT_ERROR, "Invalid journal file %s", journal_filepath);
+    reader->close(reader);
+    return false;
+  }
+
+  /* Find the offset of every chunk and the last complete index. */
+  blender::Map<JournalChunkKey, off64_t> chunk_offsets;
+  blender::Vector<JournalChunkKey> index;
+  blender::Vector<JournalChunkKey> index_read;
+  int32_t code;
+  while (reader->read(reader, &code, sizeof(code)) == sizeof(code)) {
+    if (code == JOURNAL_CODE_DATA) {
+      JournalChunkKey key;
+      if (reader->read(reader, &key, sizeof(key)) != sizeof(key)) {
+        break;
+      }
+      const off64_t offset = reader->offset;
+      if (reader->seek(reader, off64_t(key.size), SEEK_CUR) != offset + off64_t(key.size)) {
+        break;
+      }
+      chunk_offsets.add(key, offset);
+    }
+    else if (code == JOURNAL_CODE_INDEX) {
+      uint64_t chunks_num;
+      if (reader->read(reader, &chunks_num, sizeof(chunks_num)) != sizeof(chunks_num) ||
+          chunks_num > uint64_t(file_size - reader->offset) / sizeof(JournalChunkKey))
+      {
+        break;
+      }
+      index_read.resize(int64_t(chunks_num));
+      const int64_t index_size = index_read.as_span().size_in_bytes();
+      if (reader->read(reader, index_read.data(), size_t(index_size)) != index_size) {
+        break;
+      }
+      std::swap(index, index_read);
+    }
+    else {
+      break;
+    }
+  }
+
+  if (index.is_empty()) {
+    BKE_reportf(reports, RPT_ERROR, "Journal %s does not contain any data", journal_filepath);
+    reader->close(reader);
+    return false;
+  }
+
+  /* Write the chunks of the last index into a regular blend-file. */
+  char tempname[FILE_MAX + 1];
+  SNPRINTF(tempname, "%s@", filepath);
+  RawWriteWrap raw_wrap;
+  if (!raw_wrap.open(tempname)) {
+    BKE_reportf(
+        reports, RPT_ERROR, "Cannot open file %s for writing: %s", tempname, strerror(errno));
+    reader->close(reader);
+    return false;
+  }
+
+  bool success = true;
+  blender::Vector<char> buffer;
+  for (const JournalChunkKey &key : index) {
+    const off64_t offset = chunk_offsets.lookup_default(key, -1);
+    buffer.resize(int64_t(key.size));
+    if (offset == -1 || reader->seek(reader, offset, SEEK_SET) != offset ||
+        reader->read(reader, buffer.data(), key.size) != int64_t(key.size) ||
+        !raw_wrap.write(buffer.data(), key.size))
+    {
+      success = false;
+      break;
+    }
+  }
+  success &= raw_wrap.close();
+  reader->close(reader);
+
+  if (!success) {
+    BKE_reportf(reports, RPT_ERROR, "Failed to restore journal %s", journal_filepath);
+    BLI_delete(tempname, false, false);
+    return false;
+  }
+  if (BLI_rename_overwrite(tempname, filepath) != 0) {
+    BKE_report(reports, RPT_ERROR, "Cannot change old file (file saved with @)");
+    return false;
+  }
+  return true;
+}
+
+/** \} */
+
 /* -------------------------------------------------------------------- */
 /** \name File Writing (Public)
  * \{ */
@@ -227,6 +227,32 @@ void BM_face_triangulate(BMesh *bm,
                          bool use_tag,
                          struct MemArena *pf_arena,
                          struct Heap *pf_heap) ATTR_NONNULL(1, 2);
+/**
+ * Calculate the triangles #BM_face_triangulate creates for \a f, without modifying the mesh.
+ * Only reads the face, so it can run for many faces in parallel (each with its own arena & heap).
+ *
+ * \param r_tris: An array of (f->len - 2) triangles,
+ * filled with loop indices relative to the face's first loop.
+ */
+void BM_face_calc_triangulation(const BMFace *f,
+                                int quad_method,
+                                int ngon_method,
+                                uint (*r_tris)[3],
+                                struct MemArena *pf_arena,
+                                struct Heap *pf_heap) ATTR_NONNULL(1, 4);
+/**
+ * Split a face into the triangles calculated by #BM_face_calc_triangulation.
+ * Arguments match #BM_face_triangulate.
+ */
+void BM_face_triangulate_from_tris(BMesh *bm,
+                                   BMFace *f,
+                                   const uint (*tris)[3],
+                                   BMFace **r_faces_new,
+                                   int *r_faces_new_tot,
+                                   BMEdge **r_edges_new,
+                                   int *r_edges_new_tot,
+                                   struct LinkNode **r_faces_double,
+                                   bool use_tag) ATTR_NONNULL(1, 2, 3);
 
 /**
  * each pair of loops defines a new edge, a split.  this function goes
@@ -16,7 +16,10 @@
 #include "BLI_heap.h"
 #include "BLI_linklist.h"
 #include "BLI_memarena.h"
+#include "BLI_offset_indices.hh"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
+#include "BLI_vector.hh"
 
 /* only for defines */
 #include "BLI_polyfill_2d.h"
@@ -31,34 +34,26 @@
  */
 static void bm_face_triangulate_mapping(BMesh *bm,
                                         BMFace *face,
-                                        const int quad_method,
-                                        const int ngon_method,
+                                        const uint (*tris)[3],
                                         const bool use_tag,
                                         BMOperator *op,
                                         BMOpSlot *slot_facemap_out,
-                                        BMOpSlot *slot_facemap_double_out,
-
-                                        MemArena *pf_arena,
-                                        /* use for MOD_TRIANGULATE_NGON_BEAUTY only! */
-                                        Heap *pf_heap)
+                                        BMOpSlot *slot_facemap_double_out)
 {
   int faces_array_tot = face->len - 3;
   BMFace **faces_array = BLI_array_alloca(faces_array, faces_array_tot);
   LinkNode *faces_double = nullptr;
   BLI_assert(face->len > 3);
 
-  BM_face_triangulate(bm,
-                      face,
-                      faces_array,
-                      &faces_array_tot,
-                      nullptr,
-                      nullptr,
-                      &faces_double,
-                      quad_method,
-                      ngon_method,
-                      use_tag,
-                      pf_arena,
-                      pf_heap);
+  BM_face_triangulate_from_tris(bm,
+                                face,
+                                tris,
+                                faces_array,
+                                &faces_array_tot,
+                                nullptr,
+                                nullptr,
+                                &faces_double,
+                                use_tag);
 
   if (faces_array_tot) {
     int i;
@@ -85,59 +80,71 @@ void BM_mesh_triangulate(BMesh *bm,
                          BMOpSlot *slot_facemap_out,
                          BMOpSlot *slot_facemap_double_out)
 {
+  using namespace blender;
   BMIter iter;
   BMFace *face;
-  MemArena *pf_arena;
-  Heap *pf_heap;
-
-  pf_arena = BLI_memarena_new(BLI_POLYFILL_ARENA_SIZE, __func__);
 
-  if (ngon_method == MOD_TRIANGULATE_NGON_BEAUTY) {
-    pf_heap = BLI_heap_new_ex(BLI_POLYFILL_ALLOC_NGON_RESERVE);
+  Vector<BMFace *> faces;
+  Vector<int> tri_offsets_data;
+  BM_ITER_MESH (face, &iter, bm, BM_FACES_OF_MESH) {
+    if (face->len >= min_vertices) {
+      if (tag_only == false || BM_elem_flag_test(face, BM_ELEM_TAG)) {
+        faces.append(face);
+        tri_offsets_data.append(face->len - 2);
+      }
+    }
   }
-  else {
-    pf_heap = nullptr;
+  if (faces.is_empty()) {
+    return;
   }
+  tri_offsets_data.append(0);
+  const OffsetIndices tri_offsets = offset_indices::accumulate_counts_to_offsets(
+      tri_offsets_data);
+
+  /* Calculating the triangulation (especially for ngons) is the expensive part and only reads the
+   * mesh, so do it for all faces in parallel before splitting them one by one. */
+  uint(*tris)[3] = static_cast<uint(*)[3]>(
+      MEM_malloc_arrayN(tri_offsets.total_size(), sizeof(*tris), __func__));
+  threading::parallel_for(faces.index_range(), 256, [&](const IndexRange range) {
+    MemArena *pf_arena = BLI_memarena_new(BLI_POLYFILL_ARENA_SIZE, __func__);
+    Heap *pf_heap = (ngon_method == MOD_TRIANGULATE_NGON_BEAUTY) ?
+                        BLI_heap_new_ex(BLI_POLYFILL_ALLOC_NGON_RESERVE) :
+                        nullptr;
+    for (const int i : range) {
+      BM_face_calc_triangulation(
+          faces[i], quad_method, ngon_method, &tris[tri_offsets[i].start()], pf_arena, pf_heap);
+    }
+    BLI_memarena_free(pf_arena);
+    if (pf_heap) {
+      BLI_heap_free(pf_heap, nullptr);
+    }
+  });
 
   if (slot_facemap_out) {
     /* same as below but call: bm_face_triangulate_mapping() */
-    BM_ITER_MESH (face, &iter, bm, BM_FACES_OF_MESH) {
-      if (face->len >= min_vertices) {
-        if (tag_only == false || BM_elem_flag_test(face, BM_ELEM_TAG)) {
-          bm_face_triangulate_mapping(bm,
-                                      face,
-                                      quad_method,
-                                      ngon_method,
-                                      tag_only,
-                                      op,
-                                      slot_facemap_out,
-                                      slot_facemap_double_out,
-                                      pf_arena,
-                                      pf_heap);
-        }
-      }
+    for (const int i : faces.index_range()) {
+      bm_face_triangulate_mapping(bm,
+                                  faces[i],
+                                  &tris[tri_offsets[i].start()],
+                                  tag_only,
+                                  op,
+                                  slot_facemap_out,
+                                  slot_facemap_double_out);
     }
   }
   else {
     LinkNode *faces_double = nullptr;
 
-    BM_ITER_MESH (face, &iter, bm, BM_FACES_OF_MESH) {
-      if (face->len >= min_vertices) {
-        if (tag_only == false || BM_elem_flag_test(face, BM_ELEM_TAG)) {
-          BM_face_triangulate(bm,
-                              face,
-                              nullptr,
-                              nullptr,
-                              nullptr,
-                              nullptr,
-                              &faces_double,
-                              quad_method,
-                              ngon_method,
-                              tag_only,
-                              pf_arena,
-                              pf_heap);
-        }
-      }
+    for (const int i : faces.index_range()) {
+      BM_face_triangulate_from_tris(bm,
+                                    faces[i],
+                                    &tris[tri_offsets[i].start()],
+                                    nullptr,
+                                    nullptr,
+                                    nullptr,
+                                    nullptr,
+                                    &faces_double,
+                                    tag_only);
     }
 
     while (faces_double) {
@@ -148,9 +155,5 @@ void BM_mesh_triangulate(BMesh *bm,
     }
   }
 
-  BLI_memarena_free(pf_arena);
-
-  if (ngon_method == MOD_TRIANGULATE_NGON_BEAUTY) {
-    BLI_heap_free(pf_heap, nullptr);
-  }
+  MEM_freeN(tris);
 }
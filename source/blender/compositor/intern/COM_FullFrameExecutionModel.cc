@@ -94,6 +94,13 @@ MemoryBuffer *FullFrameExecutionModel::create_operation_buffer(NodeOperation *op
 
   const DataType data_type = op->get_output_socket(0)->get_data_type();
   const bool is_a_single_elem = op->get_flags().is_constant_operation;
+  if (!is_a_single_elem) {
+    std::unique_ptr<MemoryBuffer> unused_buffer = active_buffers_.take_unused_buffer(
+        COM_data_type_num_channels(data_type), rect);
+    if (unused_buffer) {
+      return unused_buffer.release();
+    }
+  }
   return new MemoryBuffer(data_type, rect, is_a_single_elem);
 }
 
@@ -2,6 +2,8 @@
  *
  * SPDX-License-Identifier: GPL-2.0-or-later */
 
+#include "BLI_rect.h"
+
 #include "COM_SharedOperationBuffers.h"
 #include "COM_NodeOperation.h"
 
@@ -86,9 +88,30 @@ void SharedOperationBuffers::read_finished(NodeOperation *read_op)
   buf_data.received_reads++;
   BLI_assert(buf_data.received_reads > 0 && buf_data.received_reads <= buf_data.registered_reads);
   if (buf_data.received_reads == buf_data.registered_reads) {
-    /* Dispose buffer. */
+    /* Dispose buffer, keeping its memory around for reuse. Single element buffers are too small
+     * to be worth it. */
+    if (buf_data.buffer && !buf_data.buffer->is_a_single_elem()) {
+      unused_buffers_.append(std::move(buf_data.buffer));
+    }
     buf_data.buffer = nullptr;
   }
 }
 
+std::unique_ptr<MemoryBuffer> SharedOperationBuffers::take_unused_buffer(const int num_channels,
+                                                                         const rcti &rect)
+{
+  for (const int i : unused_buffers_.index_range()) {
+    const MemoryBuffer &unused_buffer = *unused_buffers_[i];
+    if (unused_buffer.get_num_channels() == num_channels &&
+        BLI_rcti_compare(&unused_buffer.get_rect(), &rect))
+    {
+      std::unique_ptr<MemoryBuffer> buffer = std::move(unused_buffers_[i]);
+      unused_buffers_.remove_and_reorder(i);
+      return buffer;
+    }
+  }
+  unused_buffers_.clear();
+  return nullptr;
+}
+
 }  // namespace blender::compositor
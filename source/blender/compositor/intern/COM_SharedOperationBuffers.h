@@ -34,6 +34,12 @@ class SharedOperationBuffers {
     bool is_rendered;
   } BufferData;
   blender::Map<NodeOperation *, BufferData> buffers_;
+  /**
+   * Buffers that all reads have finished with. Operation buffers often have the same size and
+   * channels, so their memory is reused for following operations instead of freeing it right
+   * away and allocating (and page faulting) a new one.
+   */
+  blender::Vector<std::unique_ptr<MemoryBuffer>> unused_buffers_;
 
  public:
   /**
@@ -78,6 +84,13 @@ class SharedOperationBuffers {
    */
   void read_finished(NodeOperation *read_op);
 
+  /**
+   * Get a disposed buffer matching the given channels and rect, to be used as a new operation
+   * buffer. Its content is undefined. Returns null when there is none, in which case all disposed
+   * buffers are freed so the new allocation doesn't increase memory usage.
+   */
+  std::unique_ptr<MemoryBuffer> take_unused_buffer(int num_channels, const rcti &rect);
+
  private:
   BufferData &get_buffer_data(NodeOperation *op);
 
@@ -79,8 +79,36 @@ void GaussianBlurBaseOperation::update_memory_buffer_partial(MemoryBuffer *outpu
 {
   const int2 unit_offset = dimension_ == eDimension::X ? int2(1, 0) : int2(0, 1);
   MemoryBuffer *input = inputs[IMAGE_INPUT_INDEX];
+  const int input_width = input->get_width();
+  const int input_height = input->get_height();
+  /* Distance in floats between two consecutive taps of the kernel. */
+  const int tap_stride = dimension_ == eDimension::X ? input->elem_stride : input->row_stride;
   for (BuffersIterator<float> it = output->iterate_with({input}, area); !it.is_end(); ++it) {
     alignas(16) float4 accumulated_color = float4(0.0f);
+    const int2 first_tap = int2(it.x, it.y) - unit_offset * filtersize_;
+    const int2 last_tap = int2(it.x, it.y) + unit_offset * filtersize_;
+    /* Most pixels have the whole kernel inside the clamping bounds of the input, walk it without
+     * clamping every tap. */
+    if (first_tap.x >= 0 && first_tap.y >= 0 && last_tap.x < input_width &&
+        last_tap.y < input_height)
+    {
+      const float *color = input->get_elem_clamped(first_tap.x, first_tap.y);
+#if BLI_HAVE_SSE2
+      __m128 accumulated_color_sse = _mm_setzero_ps();
+      for (int i = 0; i <= filtersize_ * 2; i++, color += tap_stride) {
+        __m128 weighted_color = _mm_mul_ps(_mm_load_ps(color), gausstab_sse_[i]);
+        accumulated_color_sse = _mm_add_ps(accumulated_color_sse, weighted_color);
+      }
+      _mm_store_ps(accumulated_color, accumulated_color_sse);
+#else
+      for (int i = 0; i <= filtersize_ * 2; i++, color += tap_stride) {
+        accumulated_color += float4(color) * gausstab_[i];
+      }
+#endif
+      copy_v4_v4(it.out, accumulated_color);
+      continue;
+    }
+
 #if BLI_HAVE_SSE2
     __m128 accumulated_color_sse = _mm_setzero_ps();
     for (int i = -filtersize_; i <= filtersize_; i++) {
@@ -5,9 +5,35 @@
 #include "COM_MixOperation.h"
 
 #include "BLI_math_color.h"
+#include "BLI_simd.hh"
 
 namespace blender::compositor {
 
+#if BLI_HAVE_SSE2
+/* The most common mix operations process a whole RGBA pixel at once. */
+
+static inline __m128 mix_value_sse(const float *value,
+                                   const float *color2,
+                                   const bool use_value_alpha_multiply)
+{
+  return _mm_set1_ps(use_value_alpha_multiply ? value[0] * color2[3] : value[0]);
+}
+
+/* Store the mixed RGB channels keeping the alpha of the first color. */
+static inline void store_mix_result_sse(float *out,
+                                        const __m128 result,
+                                        const __m128 color1,
+                                        const bool use_clamp)
+{
+  const __m128 rgb_mask = _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1));
+  __m128 color = _mm_or_ps(_mm_and_ps(rgb_mask, result), _mm_andnot_ps(rgb_mask, color1));
+  if (use_clamp) {
+    color = _mm_min_ps(_mm_max_ps(color, _mm_setzero_ps()), _mm_set1_ps(1.0f));
+  }
+  _mm_storeu_ps(out, color);
+}
+#endif
+
 /* ******** Mix Base Operation ******** */
 
 MixBaseOperation::MixBaseOperation()
@@ -69,6 +95,19 @@ void MixBaseOperation::update_memory_buffer_partial(MemoryBuffer *output,
 
 void MixBaseOperation::update_memory_buffer_row(PixelCursor &p)
 {
+#if BLI_HAVE_SSE2
+  const bool use_value_alpha_multiply = this->use_value_alpha_multiply();
+  const __m128 one = _mm_set1_ps(1.0f);
+  while (p.out < p.row_end) {
+    const __m128 value = mix_value_sse(p.value, p.color2, use_value_alpha_multiply);
+    const __m128 color1 = _mm_loadu_ps(p.color1);
+    const __m128 color2 = _mm_loadu_ps(p.color2);
+    const __m128 result = _mm_add_ps(_mm_mul_ps(_mm_sub_ps(one, value), color1),
+                                     _mm_mul_ps(value, color2));
+    store_mix_result_sse(p.out, result, color1, false);
+    p.next();
+  }
+#else
   while (p.out < p.row_end) {
     float value = p.value[0];
     if (this->use_value_alpha_multiply()) {
@@ -81,12 +120,24 @@ void MixBaseOperation::update_memory_buffer_row(PixelCursor &p)
     p.out[3] = p.color1[3];
     p.next();
   }
+#endif
 }
 
 /* ******** Mix Add Operation ******** */
 
 void MixAddOperation::update_memory_buffer_row(PixelCursor &p)
 {
+#if BLI_HAVE_SSE2
+  const bool use_value_alpha_multiply = this->use_value_alpha_multiply();
+  while (p.out < p.row_end) {
+    const __m128 value = mix_value_sse(p.value, p.color2, use_value_alpha_multiply);
+    const __m128 color1 = _mm_loadu_ps(p.color1);
+    const __m128 color2 = _mm_loadu_ps(p.color2);
+    const __m128 result = _mm_add_ps(color1, _mm_mul_ps(value, color2));
+    store_mix_result_sse(p.out, result, color1, use_clamp_);
+    p.next();
+  }
+#else
   while (p.out < p.row_end) {
     float value = p.value[0];
     if (this->use_value_alpha_multiply()) {
@@ -100,6 +151,7 @@ void MixAddOperation::update_memory_buffer_row(PixelCursor &p)
     clamp_if_needed(p.out);
     p.next();
   }
+#endif
 }
 
 /* ******** Mix Blend Operation ******** */
@@ -481,6 +533,19 @@ void MixLinearLightOperation::update_memory_buffer_row(PixelCursor &p)
 
 void MixMultiplyOperation::update_memory_buffer_row(PixelCursor &p)
 {
+#if BLI_HAVE_SSE2
+  const bool use_value_alpha_multiply = this->use_value_alpha_multiply();
+  const __m128 one = _mm_set1_ps(1.0f);
+  while (p.out < p.row_end) {
+    const __m128 value = mix_value_sse(p.value, p.color2, use_value_alpha_multiply);
+    const __m128 color1 = _mm_loadu_ps(p.color1);
+    const __m128 color2 = _mm_loadu_ps(p.color2);
+    const __m128 result = _mm_mul_ps(
+        color1, _mm_add_ps(_mm_sub_ps(one, value), _mm_mul_ps(value, color2)));
+    store_mix_result_sse(p.out, result, color1, use_clamp_);
+    p.next();
+  }
+#else
   while (p.out < p.row_end) {
     float value = p.value[0];
     if (this->use_value_alpha_multiply()) {
@@ -496,6 +561,7 @@ void MixMultiplyOperation::update_memory_buffer_row(PixelCursor &p)
     clamp_if_needed(p.out);
     p.next();
   }
+#endif
 }
 
 /* ******** Mix Overlay Operation ******** */
@@ -618,6 +684,17 @@ void MixSoftLightOperation::update_memory_buffer_row(PixelCursor &p)
 
 void MixSubtractOperation::update_memory_buffer_row(PixelCursor &p)
 {
+#if BLI_HAVE_SSE2
+  const bool use_value_alpha_multiply = this->use_value_alpha_multiply();
+  while (p.out < p.row_end) {
+    const __m128 value = mix_value_sse(p.value, p.color2, use_value_alpha_multiply);
+    const __m128 color1 = _mm_loadu_ps(p.color1);
+    const __m128 color2 = _mm_loadu_ps(p.color2);
+    const __m128 result = _mm_sub_ps(color1, _mm_mul_ps(value, color2));
+    store_mix_result_sse(p.out, result, color1, use_clamp_);
+    p.next();
+  }
+#else
   while (p.out < p.row_end) {
     float value = p.value[0];
     if (this->use_value_alpha_multiply()) {
@@ -631,6 +708,7 @@ void MixSubtractOperation::update_memory_buffer_row(PixelCursor &p)
     clamp_if_needed(p.out);
     p.next();
   }
+#endif
 }
 
 /* ******** Mix Value Operation ******** */
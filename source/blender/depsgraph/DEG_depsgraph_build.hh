@@ -72,6 +72,15 @@ void DEG_graph_relations_update(Depsgraph *graph);
 /** Tag all relations in the database for update. */
 void DEG_relations_tag_update(Main *bmain);
 
+/**
+ * Tag relations for update in the graphs which contain \a id, for changes which only affect the
+ * relations built for \a id itself (like adding a modifier or a constraint to an object).
+ *
+ * Graphs which don't contain \a id are not rebuilt, so this must not be used for changes which
+ * make \a id (or other IDs) part of new graphs, use #DEG_relations_tag_update for those.
+ */
+void DEG_id_relations_tag_update(Main *bmain, ID *id);
+
 /* Add Dependencies  ----------------------------- */
 
 /**
@@ -40,6 +40,19 @@ void DEG_stats_simple(const Depsgraph *graph,
                       size_t *r_operations,
                       size_t *r_relations);
 
+/**
+ * Obtain the size of the geometry arrays of the evaluated copies made during the last evaluation.
+ * \param[out] r_copied: The number of bytes duplicated for the evaluated copies.
+ * \param[out] r_shared: The number of bytes shared with the original data-blocks.
+ */
+void DEG_stats_eval_copy_memory(const Depsgraph *graph, size_t *r_copied, size_t *r_shared);
+
+/**
+ * Obtain the size of the evaluated geometry freed since the graph was created, because the
+ * objects it belongs to stayed invisible.
+ */
+size_t DEG_stats_evicted_geometry_memory(const Depsgraph *graph);
+
 /* ************************************************ */
 /* Diagram-Based Graph Debugging */
 
@@ -50,6 +63,21 @@ void DEG_debug_stats_gnuplot(const Depsgraph *graph,
                              const char *label,
                              const char *output_filename);
 
+/* ************************************************ */
+/* Evaluation Tracing */
+
+/**
+ * Start recording the evaluation of every operation of the graph (with timing and thread), until
+ * #DEG_debug_trace_end is called.
+ */
+void DEG_debug_trace_begin(Depsgraph *graph);
+/**
+ * Stop recording, writing the evaluations recorded since #DEG_debug_trace_begin to \a fp (if not
+ * null) in the Chrome trace event format (JSON), which can also be opened by Perfetto.
+ */
+void DEG_debug_trace_end(Depsgraph *graph, FILE *fp);
+bool DEG_debug_trace_is_active(const Depsgraph *graph);
+
 /* ************************************************ */
 
 /** Compare two dependency graphs. */
@@ -12,6 +12,7 @@
 
 #include <cstdio>
 #include <cstdlib>
+#include <memory>
 
 #include "MEM_guardedalloc.h"
 
@@ -1321,12 +1322,15 @@ void DepsgraphNodeBuilder::build_driver(ID *id, FCurve *fcurve, int driver_index
    * has not yet been allocated at this point we can't. As a workaround
    * the animation systems allocates an array so we can do a fast lookup
    * with the driver index. */
+  /* The cache is freed with the operation node, when the relations are rebuilt. */
+  std::shared_ptr<DriverTargetPathCache> path_cache(driver_target_path_cache_new(),
+                                                    driver_target_path_cache_free);
   ensure_operation_node(
       id,
       NodeType::PARAMETERS,
       OperationCode::DRIVER,
-      [id_cow, driver_index, fcurve](::Depsgraph *depsgraph) {
-        BKE_animsys_eval_driver(depsgraph, id_cow, driver_index, fcurve);
+      [id_cow, driver_index, fcurve, path_cache](::Depsgraph *depsgraph) {
+        BKE_animsys_eval_driver(depsgraph, id_cow, driver_index, fcurve, path_cache.get());
       },
       fcurve->rna_path ? fcurve->rna_path : "",
       fcurve->array_index);
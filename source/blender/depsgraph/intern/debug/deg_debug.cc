@@ -16,11 +16,21 @@
 
 #include "BKE_global.hh"
 
+#include "intern/debug/deg_debug_trace.h"
 #include "intern/depsgraph.hh"
 
 namespace blender::deg {
 
-DepsgraphDebug::DepsgraphDebug() : flags(G.debug), graph_evaluation_start_time_(0) {}
+DepsgraphDebug::DepsgraphDebug()
+    : flags(G.debug),
+      eval_copy_copied_bytes(0),
+      eval_copy_shared_bytes(0),
+      evicted_geometry_bytes(0),
+      graph_evaluation_start_time_(0)
+{
+}
+
+DepsgraphDebug::~DepsgraphDebug() = default;
 
 bool DepsgraphDebug::do_time_debug() const
 {
@@ -29,6 +39,13 @@ bool DepsgraphDebug::do_time_debug() const
 
 void DepsgraphDebug::begin_graph_evaluation()
 {
+  if (trace) {
+    trace->begin_graph_evaluation();
+  }
+
+  eval_copy_copied_bytes = 0;
+  eval_copy_shared_bytes = 0;
+
   if (!do_time_debug()) {
     return;
   }
@@ -40,6 +57,10 @@ void DepsgraphDebug::begin_graph_evaluation()
 
 void DepsgraphDebug::end_graph_evaluation()
 {
+  if (trace) {
+    trace->end_graph_evaluation();
+  }
+
   if (!do_time_debug()) {
     return;
   }
@@ -47,11 +68,23 @@ void DepsgraphDebug::end_graph_evaluation()
   const double graph_eval_end_time = BLI_time_now_seconds();
   const double graph_eval_time = graph_eval_end_time - graph_evaluation_start_time_;
 
+  char copied_str[BLI_STR_FORMAT_INT64_BYTE_UNIT_SIZE];
+  char shared_str[BLI_STR_FORMAT_INT64_BYTE_UNIT_SIZE];
+  BLI_str_format_byte_unit(copied_str, int64_t(eval_copy_copied_bytes), true);
+  BLI_str_format_byte_unit(shared_str, int64_t(eval_copy_shared_bytes), true);
+
   if (name.empty()) {
-    printf("Depsgraph updated in %f seconds.\n", graph_eval_time);
+    printf("Depsgraph updated in %f seconds (evaluated copies: %s copied, %s shared).\n",
+           graph_eval_time,
+           copied_str,
+           shared_str);
   }
   else {
-    printf("Depsgraph [%s] updated in %f seconds.\n", name.c_str(), graph_eval_time);
+    printf("Depsgraph [%s] updated in %f seconds (evaluated copies: %s copied, %s shared).\n",
+           name.c_str(),
+           graph_eval_time,
+           copied_str,
+           shared_str);
   }
 }
 
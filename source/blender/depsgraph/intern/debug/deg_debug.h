@@ -8,6 +8,9 @@
 
 #pragma once
 
+#include <atomic>
+#include <memory>
+
 #include "intern/depsgraph_type.hh"
 
 #include "BKE_global.hh"
@@ -16,9 +19,12 @@
 
 namespace blender::deg {
 
+class DepsgraphTrace;
+
 class DepsgraphDebug {
  public:
   DepsgraphDebug();
+  ~DepsgraphDebug();
 
   bool do_time_debug() const;
 
@@ -32,6 +38,17 @@ class DepsgraphDebug {
    * created for different view layer). */
   string name;
 
+  /* Recording of operations evaluation, see #DEG_debug_trace_begin. */
+  std::unique_ptr<DepsgraphTrace> trace;
+
+  /* Size of the geometry arrays of the evaluated copies made during the current (or last)
+   * evaluation, either duplicated or shared with the original data-blocks. */
+  std::atomic<size_t> eval_copy_copied_bytes;
+  std::atomic<size_t> eval_copy_shared_bytes;
+
+  /* Size of the evaluated geometry freed because it stayed invisible, since the graph creation. */
+  size_t evicted_geometry_bytes;
+
  protected:
   /* Maximum number of counters used to calculate frame rate of depsgraph update. */
   static const constexpr int MAX_FPS_COUNTERS = 64;
@@ -0,0 +1,118 @@
+/* SPDX-FileCopyrightText: 2024 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file
+ * \ingroup depsgraph
+ */
+
+#include "intern/debug/deg_debug_trace.h"
+
+#include "BLI_time.h"
+#include "BLI_utildefines.h"
+
+#include "intern/node/deg_node.hh"
+#include "intern/node/deg_node_component.hh"
+#include "intern/node/deg_node_id.hh"
+#include "intern/node/deg_node_operation.hh"
+
+namespace blender::deg {
+
+/* Thread of the events covering whole evaluations, operations use the following ones. */
+#define TRACE_EVALUATION_THREAD 0
+
+DepsgraphTrace::DepsgraphTrace()
+    : trace_start_time_(BLI_time_now_seconds()), evaluation_start_time_(0), evaluations_num_(0)
+{
+}
+
+void DepsgraphTrace::begin_graph_evaluation()
+{
+  evaluation_start_time_ = BLI_time_now_seconds();
+}
+
+void DepsgraphTrace::record_operation(const OperationNode *operation_node,
+                                      const double start_time,
+                                      const double end_time)
+{
+  evaluated_operations_.local().append({operation_node, start_time, end_time});
+}
+
+void DepsgraphTrace::end_graph_evaluation()
+{
+  const int evaluation = evaluations_num_++;
+
+  Event evaluation_event;
+  evaluation_event.name = "Evaluation " + std::to_string(evaluation);
+  evaluation_event.category = "Depsgraph";
+  evaluation_event.start_time = evaluation_start_time_;
+  evaluation_event.end_time = BLI_time_now_seconds();
+  evaluation_event.thread = TRACE_EVALUATION_THREAD;
+  evaluation_event.evaluation = evaluation;
+  events_.append(std::move(evaluation_event));
+
+  /* The order of the thread-local storages is stable, so it can be used as thread index. */
+  int thread = TRACE_EVALUATION_THREAD + 1;
+  for (Vector<EvaluatedOperation> &evaluated_operations : evaluated_operations_) {
+    for (const EvaluatedOperation &evaluated : evaluated_operations) {
+      const OperationNode *operation_node = evaluated.operation_node;
+      const ComponentNode *component_node = operation_node->owner;
+      Event event;
+      event.name = operation_node->identifier();
+      event.category = nodeTypeAsString(component_node->type);
+      event.id_name = component_node->owner->name;
+      event.start_time = evaluated.start_time;
+      event.end_time = evaluated.end_time;
+      event.thread = thread;
+      event.evaluation = evaluation;
+      events_.append(std::move(event));
+    }
+    evaluated_operations.clear();
+    thread++;
+  }
+}
+
+static void write_json_string(FILE *fp, const string &str)
+{
+  fputc('"', fp);
+  for (const char c : str) {
+    if (ELEM(c, '"', '\\')) {
+      fputc('\\', fp);
+      fputc(c, fp);
+    }
+    else if (uchar(c) < 0x20) {
+      fprintf(fp, "\\u%04x", uint(c));
+    }
+    else {
+      fputc(c, fp);
+    }
+  }
+  fputc('"', fp);
+}
+
+void DepsgraphTrace::write_chrome_trace(FILE *fp) const
+{
+  fprintf(fp, "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n");
+  bool is_first = true;
+  for (const Event &event : events_) {
+    if (!is_first) {
+      fprintf(fp, ",\n");
+    }
+    is_first = false;
+    /* Complete events, times are in microseconds. */
+    fprintf(fp, "{\"ph\": \"X\", \"pid\": 1, \"tid\": %d, \"name\": ", event.thread);
+    write_json_string(fp, event.name);
+    fprintf(fp, ", \"cat\": ");
+    write_json_string(fp, event.category);
+    fprintf(fp,
+            ", \"ts\": %.3f, \"dur\": %.3f, \"args\": {\"evaluation\": %d, \"id\": ",
+            (event.start_time - trace_start_time_) * 1e6,
+            (event.end_time - event.start_time) * 1e6,
+            event.evaluation);
+    write_json_string(fp, event.id_name);
+    fprintf(fp, "}}");
+  }
+  fprintf(fp, "\n]}\n");
+}
+
+}  // namespace blender::deg
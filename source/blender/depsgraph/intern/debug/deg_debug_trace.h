@@ -0,0 +1,62 @@
+/* SPDX-FileCopyrightText: 2024 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file
+ * \ingroup depsgraph
+ */
+
+#pragma once
+
+#include <cstdio>
+
+#include "BLI_enumerable_thread_specific.hh"
+#include "BLI_vector.hh"
+
+#include "intern/depsgraph_type.hh"
+
+namespace blender::deg {
+
+struct OperationNode;
+
+/* Recording of the evaluation of every operation, in evaluation order and per thread.
+ * Exported in the Chrome trace event format, which can be inspected with `chrome://tracing` or
+ * Perfetto. */
+class DepsgraphTrace {
+ public:
+  DepsgraphTrace();
+
+  void begin_graph_evaluation();
+  /* Thread-safe, may be called from any thread evaluating operations. */
+  void record_operation(const OperationNode *operation_node, double start_time, double end_time);
+  void end_graph_evaluation();
+
+  void write_chrome_trace(FILE *fp) const;
+
+ protected:
+  /* Operation evaluated during the current graph evaluation. Operation nodes might be freed by
+   * the next relations update, so these are converted to #Event at the end of the evaluation. */
+  struct EvaluatedOperation {
+    const OperationNode *operation_node;
+    double start_time;
+    double end_time;
+  };
+  struct Event {
+    string name;
+    string category;
+    string id_name;
+    double start_time;
+    double end_time;
+    int thread;
+    int evaluation;
+  };
+
+  double trace_start_time_;
+  double evaluation_start_time_;
+  int evaluations_num_;
+
+  threading::EnumerableThreadSpecific<Vector<EvaluatedOperation>> evaluated_operations_;
+  Vector<Event> events_;
+};
+
+}  // namespace blender::deg
@@ -178,6 +178,10 @@ struct Depsgraph {
   /* The number of times this graph has been evaluated. */
   uint64_t update_count;
 
+  /* Whether #OperationNode.critical_path_cost is to be computed after the next evaluation
+   * (set when the operations are rebuilt). */
+  bool need_update_critical_path;
+
   /**
    * Stores functions that can be called after depsgraph evaluation to writeback some changes to
    * original data. Also see `DEG_depsgraph_writeback_sync.hh`.
@@ -321,3 +321,16 @@ void DEG_relations_tag_update(Main *bmain)
     DEG_graph_tag_relations_update(reinterpret_cast<Depsgraph *>(depsgraph));
   }
 }
+
+void DEG_id_relations_tag_update(Main *bmain, ID *id)
+{
+  DEG_GLOBAL_DEBUG_PRINTF(TAG, "%s: Tagging relations of %s for update.\n", __func__, id->name);
+  for (deg::Depsgraph *depsgraph : deg::get_all_registered_graphs(bmain)) {
+    /* Relations built for the ID only exist in graphs which contain it. A graph which is already
+     * tagged will be fully rebuilt anyway. */
+    if (depsgraph->need_update_relations || depsgraph->find_id_node(id) == nullptr) {
+      continue;
+    }
+    DEG_graph_tag_relations_update(reinterpret_cast<Depsgraph *>(depsgraph));
+  }
+}
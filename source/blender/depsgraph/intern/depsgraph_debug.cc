@@ -20,6 +20,7 @@
 #include "DEG_depsgraph_query.hh"
 
 #include "intern/debug/deg_debug.h"
+#include "intern/debug/deg_debug_trace.h"
 #include "intern/depsgraph.hh"
 #include "intern/depsgraph_relation.hh"
 #include "intern/depsgraph_type.hh"
@@ -53,6 +54,32 @@ const char *DEG_debug_name_get(Depsgraph *depsgraph)
   return deg_graph->debug.name.c_str();
 }
 
+void DEG_debug_trace_begin(Depsgraph *graph)
+{
+  deg::Depsgraph *deg_graph = reinterpret_cast<deg::Depsgraph *>(graph);
+  BLI_assert(!deg_graph->is_evaluating);
+  deg_graph->debug.trace = std::make_unique<deg::DepsgraphTrace>();
+}
+
+void DEG_debug_trace_end(Depsgraph *graph, FILE *fp)
+{
+  deg::Depsgraph *deg_graph = reinterpret_cast<deg::Depsgraph *>(graph);
+  BLI_assert(!deg_graph->is_evaluating);
+  if (!deg_graph->debug.trace) {
+    return;
+  }
+  if (fp != nullptr) {
+    deg_graph->debug.trace->write_chrome_trace(fp);
+  }
+  deg_graph->debug.trace.reset();
+}
+
+bool DEG_debug_trace_is_active(const Depsgraph *graph)
+{
+  const deg::Depsgraph *deg_graph = reinterpret_cast<const deg::Depsgraph *>(graph);
+  return deg_graph->debug.trace != nullptr;
+}
+
 bool DEG_debug_compare(const Depsgraph *graph1, const Depsgraph *graph2)
 {
   BLI_assert(graph1 != nullptr);
@@ -181,6 +208,19 @@ bool DEG_debug_consistency_check(Depsgraph *graph)
 
 /* ------------------------------------------------ */
 
+void DEG_stats_eval_copy_memory(const Depsgraph *graph, size_t *r_copied, size_t *r_shared)
+{
+  const deg::Depsgraph *deg_graph = reinterpret_cast<const deg::Depsgraph *>(graph);
+  *r_copied = deg_graph->debug.eval_copy_copied_bytes;
+  *r_shared = deg_graph->debug.eval_copy_shared_bytes;
+}
+
+size_t DEG_stats_evicted_geometry_memory(const Depsgraph *graph)
+{
+  const deg::Depsgraph *deg_graph = reinterpret_cast<const deg::Depsgraph *>(graph);
+  return deg_graph->debug.evicted_geometry_bytes;
+}
+
 void DEG_stats_simple(const Depsgraph *graph,
                       size_t *r_outer,
                       size_t *r_operations,
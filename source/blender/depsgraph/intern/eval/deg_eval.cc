@@ -10,12 +10,15 @@
 
 #include "intern/eval/deg_eval.h"
 
+#include <algorithm>
+
 #include "BLI_compiler_attrs.h"
 #include "BLI_function_ref.hh"
 #include "BLI_gsqueue.h"
 #include "BLI_task.h"
 #include "BLI_time.h"
 #include "BLI_utildefines.h"
+#include "BLI_vector.hh"
 
 #include "BKE_global.hh"
 
@@ -32,6 +35,7 @@
 
 #include "atomic_ops.h"
 
+#include "intern/debug/deg_debug_trace.h"
 #include "intern/depsgraph.hh"
 #include "intern/depsgraph_relation.hh"
 #include "intern/depsgraph_tag.hh"
@@ -47,6 +51,9 @@
 
 namespace blender::deg {
 
+/* Number of evaluations between updates of #OperationNode.critical_path_cost. */
+#define DEG_CRITICAL_PATH_UPDATE_INTERVAL 8
+
 namespace {
 
 struct DepsgraphEvalState;
@@ -80,6 +87,8 @@ enum class EvaluationStage {
 struct DepsgraphEvalState {
   Depsgraph *graph;
   bool do_stats;
+  /* Recording of the evaluated operations, if any. */
+  DepsgraphTrace *trace;
   EvaluationStage stage;
   bool need_update_pending_parents = true;
   bool need_single_thread_pass = false;
@@ -91,15 +100,21 @@ void evaluate_node(const DepsgraphEvalState *state, OperationNode *operation_nod
 
   /* Sanity checks. */
   BLI_assert_msg(!operation_node->is_noop(), "NOOP nodes should not actually be scheduled");
-  /* Perform operation. */
+  /* Perform operation. The timing is always measured, as it's used to prioritize operations on
+   * the critical path in the next evaluations. */
+  const double start_time = BLI_time_now_seconds();
+  operation_node->evaluate(depsgraph);
+  const double eval_time = BLI_time_now_seconds() - start_time;
   if (state->do_stats) {
-    const double start_time = BLI_time_now_seconds();
-    operation_node->evaluate(depsgraph);
-    operation_node->stats.current_time += BLI_time_now_seconds() - start_time;
+    operation_node->stats.current_time += eval_time;
   }
-  else {
-    operation_node->evaluate(depsgraph);
+  if (state->trace) {
+    state->trace->record_operation(operation_node, start_time, start_time + eval_time);
   }
+  /* Smooth the estimate, timings of a single evaluation are noisy. */
+  operation_node->eval_cost = (operation_node->eval_cost == 0.0f) ?
+                                  float(eval_time) :
+                                  0.5f * (operation_node->eval_cost + float(eval_time));
 
   /* Clear the flag early on, allowing partial updates without re-evaluating the same node multiple
    * times.
@@ -108,19 +123,36 @@ void evaluate_node(const DepsgraphEvalState *state, OperationNode *operation_nod
   operation_node->flag &= ~DEPSOP_FLAG_CLEAR_ON_EVAL;
 }
 
+/* Sort operations so that the ones starting the longest chain of operations come first. */
+void sort_by_critical_path(MutableSpan<OperationNode *> nodes)
+{
+  std::stable_sort(nodes.begin(), nodes.end(), [](const OperationNode *a, const OperationNode *b) {
+    return a->critical_path_cost > b->critical_path_cost;
+  });
+}
+
 void deg_task_run_func(TaskPool *pool, void *taskdata)
 {
   void *userdata_v = BLI_task_pool_user_data(pool);
   DepsgraphEvalState *state = (DepsgraphEvalState *)userdata_v;
 
-  /* Evaluate node. */
   OperationNode *operation_node = reinterpret_cast<OperationNode *>(taskdata);
-  evaluate_node(state, operation_node);
+  Vector<OperationNode *, 16> ready_children;
+  while (operation_node != nullptr) {
+    /* Evaluate node. */
+    evaluate_node(state, operation_node);
 
-  /* Schedule children. */
-  schedule_children(state, operation_node, [&](OperationNode *node) {
-    BLI_task_pool_push(pool, deg_task_run_func, node, false, nullptr);
-  });
+    /* Schedule children. The most critical one is evaluated by this thread right away, others
+     * are pushed in order of decreasing priority (other threads take the oldest tasks first). */
+    ready_children.clear();
+    schedule_children(
+        state, operation_node, [&](OperationNode *node) { ready_children.append(node); });
+    sort_by_critical_path(ready_children);
+    for (OperationNode *node : ready_children.as_span().drop_front(1)) {
+      BLI_task_pool_push(pool, deg_task_run_func, node, false, nullptr);
+    }
+    operation_node = ready_children.is_empty() ? nullptr : ready_children.first();
+  }
 }
 
 bool check_operation_node_visible(const DepsgraphEvalState *state, OperationNode *op_node)
@@ -317,9 +349,12 @@ void evaluate_graph_threaded_stage(DepsgraphEvalState *state,
 
   calculate_pending_parents_if_needed(state);
 
-  schedule_graph(state, [&](OperationNode *node) {
+  Vector<OperationNode *> ready_nodes;
+  schedule_graph(state, [&](OperationNode *node) { ready_nodes.append(node); });
+  sort_by_critical_path(ready_nodes);
+  for (OperationNode *node : ready_nodes) {
     BLI_task_pool_push(task_pool, deg_task_run_func, node, false, nullptr);
-  });
+  }
   BLI_task_pool_work_and_wait(task_pool);
 }
 
@@ -402,6 +437,7 @@ void deg_evaluate_on_refresh(Depsgraph *graph)
   DepsgraphEvalState state;
   state.graph = graph;
   state.do_stats = graph->debug.do_time_debug();
+  state.trace = graph->debug.trace.get();
 
   /* Prepare all nodes for evaluation. */
   initialize_execution(&state, graph);
@@ -457,6 +493,16 @@ void deg_evaluate_on_refresh(Depsgraph *graph)
     deg_eval_stats_aggregate(graph);
   }
 
+  /* Refresh the scheduling priorities from the new timings once in a while, timings don't change
+   * much between evaluations and not all operations are evaluated every time. */
+  if (graph->need_update_critical_path ||
+      (graph->update_count % DEG_CRITICAL_PATH_UPDATE_INTERVAL) == 0)
+  {
+    deg_eval_critical_path_update(graph);
+  }
+
+  deg_graph_evict_invisible_geometry(graph);
+
   /* Clear any uncleared tags. */
   deg_graph_clear_tags(graph);
   graph->is_evaluating = false;
@@ -26,6 +26,8 @@
 #include "BLI_utildefines.h"
 
 #include "BKE_curve.hh"
+#include "BKE_curves.hh"
+#include "BKE_customdata.hh"
 #include "BKE_global.hh"
 #include "BKE_gpencil_legacy.h"
 #include "BKE_gpencil_update_cache_legacy.h"
@@ -49,6 +51,7 @@
 #include "DNA_modifier_types.h"
 #include "DNA_object_types.h"
 #include "DNA_particle_types.h"
+#include "DNA_pointcloud_types.h"
 #include "DNA_rigidbody_types.h"
 #include "DNA_scene_types.h"
 #include "DNA_sequence_types.h"
@@ -761,6 +764,71 @@ int foreach_libblock_validate_callback(LibraryIDLinkCallbackData *cb_data)
   return IDWALK_RET_NOP;
 }
 
+/* Accumulate the size of the geometry arrays of the freshly made evaluated copy into the depsgraph
+ * statistics, splitting arrays that are shared with the original (using implicit sharing) from
+ * the ones that had to be duplicated. */
+void eval_copy_count_memory(const Depsgraph *depsgraph, const ID *id_cow)
+{
+  size_t copied_bytes = 0;
+  size_t shared_bytes = 0;
+  auto count_array = [&](const void *data,
+                         const size_t size,
+                         const ImplicitSharingInfo *sharing_info) {
+    if (data == nullptr) {
+      return;
+    }
+    /* Right after the copy, arrays shared with the original have several users. */
+    if (sharing_info != nullptr && !sharing_info->is_mutable()) {
+      shared_bytes += size;
+    }
+    else {
+      copied_bytes += size;
+    }
+  };
+  auto count_custom_data = [&](const CustomData &data, const int totelem) {
+    for (const CustomDataLayer &layer : Span(data.layers, data.totlayer)) {
+      count_array(layer.data,
+                  size_t(CustomData_sizeof(eCustomDataType(layer.type))) * size_t(totelem),
+                  layer.sharing_info);
+    }
+  };
+
+  switch (GS(id_cow->name)) {
+    case ID_ME: {
+      const Mesh *mesh = reinterpret_cast<const Mesh *>(id_cow);
+      count_custom_data(mesh->vert_data, mesh->verts_num);
+      count_custom_data(mesh->edge_data, mesh->edges_num);
+      count_custom_data(mesh->face_data, mesh->faces_num);
+      count_custom_data(mesh->corner_data, mesh->corners_num);
+      count_array(mesh->face_offset_indices,
+                  sizeof(int) * size_t(mesh->faces_num + 1),
+                  mesh->runtime->face_offsets_sharing_info);
+      break;
+    }
+    case ID_CV: {
+      const bke::CurvesGeometry &curves =
+          reinterpret_cast<const Curves *>(id_cow)->geometry.wrap();
+      count_custom_data(curves.point_data, curves.points_num());
+      count_custom_data(curves.curve_data, curves.curves_num());
+      count_array(curves.curve_offsets,
+                  sizeof(int) * size_t(curves.curves_num() + 1),
+                  curves.runtime->curve_offsets_sharing_info);
+      break;
+    }
+    case ID_PT: {
+      const PointCloud *pointcloud = reinterpret_cast<const PointCloud *>(id_cow);
+      count_custom_data(pointcloud->pdata, pointcloud->totpoint);
+      break;
+    }
+    default:
+      return;
+  }
+
+  DepsgraphDebug &debug = const_cast<Depsgraph *>(depsgraph)->debug;
+  debug.eval_copy_copied_bytes += copied_bytes;
+  debug.eval_copy_shared_bytes += shared_bytes;
+}
+
 /* Actual implementation of logic which "expands" all the data which was not
  * yet copied-on-eval.
  *
@@ -823,6 +891,7 @@ ID *deg_expand_eval_copy_datablock(const Depsgraph *depsgraph, const IDNode *id_
   if (!done) {
     BLI_assert_msg(0, "No idea how to perform evaluated copy on datablock");
   }
+  eval_copy_count_memory(depsgraph, id_cow);
   /* Update pointers to nested ID datablocks. */
   DEG_COW_PRINT(
       "  Remapping ID links for %s: id_orig=%p id_cow=%p\n", id_orig->name, id_orig, id_cow);
@@ -8,9 +8,13 @@
 
 #include "intern/eval/deg_eval_stats.h"
 
+#include <algorithm>
+
 #include "BLI_utildefines.h"
+#include "BLI_vector.hh"
 
 #include "intern/depsgraph.hh"
+#include "intern/depsgraph_relation.hh"
 
 #include "intern/node/deg_node.hh"
 #include "intern/node/deg_node_component.hh"
@@ -39,4 +43,49 @@ void deg_eval_stats_aggregate(Depsgraph *graph)
   }
 }
 
+void deg_eval_critical_path_update(Depsgraph *graph)
+{
+  /* Negative values tag operations which are not visited yet. */
+  for (OperationNode *op_node : graph->operations) {
+    op_node->critical_path_cost = -1.0f;
+  }
+
+  /* Depth-first traversal along non-cyclic relations, an operation is finished once all its
+   * children are. The stack stores the operation and the index of its next relation to visit. */
+  Vector<std::pair<OperationNode *, int>, 64> stack;
+  for (OperationNode *root : graph->operations) {
+    if (root->critical_path_cost >= 0.0f) {
+      continue;
+    }
+    root->critical_path_cost = 0.0f;
+    stack.append({root, 0});
+    while (!stack.is_empty()) {
+      auto &[op_node, relation_index] = stack.last();
+      if (relation_index < op_node->outlinks.size()) {
+        const Relation *rel = op_node->outlinks[relation_index++];
+        if (rel->flag & RELATION_FLAG_CYCLIC) {
+          continue;
+        }
+        OperationNode *child = static_cast<OperationNode *>(rel->to);
+        if (child->critical_path_cost < 0.0f) {
+          child->critical_path_cost = 0.0f;
+          stack.append({child, 0});
+        }
+        continue;
+      }
+      float children_cost = 0.0f;
+      for (const Relation *rel : op_node->outlinks) {
+        if ((rel->flag & RELATION_FLAG_CYCLIC) == 0) {
+          const OperationNode *child = static_cast<const OperationNode *>(rel->to);
+          children_cost = std::max(children_cost, child->critical_path_cost);
+        }
+      }
+      op_node->critical_path_cost = op_node->eval_cost + children_cost;
+      stack.remove_last();
+    }
+  }
+
+  graph->need_update_critical_path = false;
+}
+
 }  // namespace blender::deg
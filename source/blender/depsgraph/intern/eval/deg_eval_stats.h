@@ -15,4 +15,8 @@ struct Depsgraph;
 /* Aggregate operation timings to overall component and ID nodes timing. */
 void deg_eval_stats_aggregate(Depsgraph *graph);
 
+/* Update the estimated cost of the longest chain of operations starting at every operation, from
+ * the estimated evaluation cost of the operations. */
+void deg_eval_critical_path_update(Depsgraph *graph);
+
 }  // namespace blender::deg
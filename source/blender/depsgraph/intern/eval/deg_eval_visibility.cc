@@ -9,13 +9,20 @@
 #include "intern/eval/deg_eval_visibility.h"
 
 #include "DNA_layer_types.h"
+#include "DNA_mesh_types.h"
 #include "DNA_modifier_types.h"
 #include "DNA_object_types.h"
+#include "DNA_userdef_types.h"
 
 #include "BLI_assert.h"
 #include "BLI_listbase.h"
+#include "BLI_memory_counter.hh"
 #include "BLI_stack.h"
 
+#include "BKE_geometry_set.hh"
+#include "BKE_object.hh"
+#include "BKE_object_types.hh"
+
 #include "DEG_depsgraph.hh"
 
 #include "intern/depsgraph.hh"
@@ -25,6 +32,9 @@
 #include "intern/node/deg_node_id.hh"
 #include "intern/node/deg_node_operation.hh"
 
+/* Number of evaluations an object stays invisible before its evaluated geometry is freed. */
+#define DEG_EVICT_INVISIBLE_GEOMETRY_EVALUATIONS 32
+
 namespace blender::deg {
 
 void deg_evaluate_object_node_visibility(::Depsgraph *depsgraph, IDNode *id_node)
@@ -233,4 +243,79 @@ void deg_graph_flush_visibility_flags_if_needed(Depsgraph *graph)
   deg_graph_flush_visibility_flags(graph);
 }
 
+static size_t object_evaluated_geometry_bytes(const Object *object)
+{
+  memory_counter::MemoryCount count;
+  memory_counter::MemoryCounter counter{count};
+  if (object->runtime->geometry_set_eval != nullptr) {
+    object->runtime->geometry_set_eval->count_memory(counter);
+  }
+  else if (object->runtime->data_eval != nullptr && object->runtime->is_data_eval_owned &&
+           GS(object->runtime->data_eval->name) == ID_ME)
+  {
+    reinterpret_cast<const Mesh *>(object->runtime->data_eval)->count_memory(counter);
+  }
+  return count.total_bytes;
+}
+
+void deg_graph_evict_invisible_geometry(Depsgraph *graph)
+{
+  if (!U.experimental.use_evict_invisible_evaluated_data) {
+    return;
+  }
+  /* Only the viewport graph is evaluated over and over again. */
+  if (!graph->is_active || graph->mode != DAG_EVAL_VIEWPORT || !graph->use_visibility_optimization)
+  {
+    return;
+  }
+
+  for (IDNode *id_node : graph->id_nodes) {
+    if (id_node->id_type != ID_OB) {
+      continue;
+    }
+    ComponentNode *geometry_component = id_node->find_component(NodeType::GEOMETRY);
+    if (geometry_component == nullptr) {
+      continue;
+    }
+    if (geometry_component->affects_visible_id) {
+      id_node->num_invisible_evaluations = 0;
+      continue;
+    }
+    if (++id_node->num_invisible_evaluations < DEG_EVICT_INVISIBLE_GEOMETRY_EVALUATIONS) {
+      continue;
+    }
+
+    Object *object_cow = reinterpret_cast<Object *>(id_node->id_cow);
+    if (object_cow->runtime->data_eval == nullptr &&
+        object_cow->runtime->geometry_set_eval == nullptr)
+    {
+      /* Nothing evaluated, or already evicted. */
+      continue;
+    }
+    if (BKE_object_is_in_editmode(reinterpret_cast<const Object *>(id_node->id_orig))) {
+      continue;
+    }
+
+    const size_t bytes = object_evaluated_geometry_bytes(object_cow);
+    BKE_object_free_derived_caches(object_cow);
+    graph->debug.evicted_geometry_bytes += bytes;
+
+    /* Invisible operations are not evaluated and keep their tag until they become visible. */
+    for (OperationNode *op_node : geometry_component->operations) {
+      op_node->flag |= DEPSOP_FLAG_NEEDS_UPDATE;
+    }
+    if (ComponentNode *batch_cache_component = id_node->find_component(NodeType::BATCH_CACHE)) {
+      for (OperationNode *op_node : batch_cache_component->operations) {
+        op_node->flag |= DEPSOP_FLAG_NEEDS_UPDATE;
+      }
+    }
+
+    DEG_DEBUG_PRINTF(reinterpret_cast<::Depsgraph *>(graph),
+                     EVAL,
+                     "Freed %zu bytes of invisible evaluated geometry of %s\n",
+                     bytes,
+                     id_node->id_orig->name);
+  }
+}
+
 }  // namespace blender::deg
@@ -27,4 +27,9 @@ void deg_evaluate_object_modifiers_mode_node_visibility(::Depsgraph *depsgraph,
 void deg_graph_flush_visibility_flags(Depsgraph *graph);
 void deg_graph_flush_visibility_flags_if_needed(Depsgraph *graph);
 
+/* Free the evaluated geometry of objects which were not needed for anything visible during the
+ * last #DEG_EVICT_INVISIBLE_GEOMETRY_EVALUATIONS evaluations. The geometry is tagged for update,
+ * so that it is evaluated again once it becomes visible. */
+void deg_graph_evict_invisible_geometry(Depsgraph *graph);
+
 }  // namespace blender::deg
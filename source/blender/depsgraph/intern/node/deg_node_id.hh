@@ -124,6 +124,10 @@ struct IDNode : public Node {
   /* Accumulate recalc flags from multiple update passes. */
   int id_cow_recalc_backup;
 
+  /* Number of evaluations in a row during which the geometry of the object was not needed for
+   * anything visible, see #deg_graph_evict_invisible_geometry. */
+  int num_invisible_evaluations;
+
   IDComponentsMask visible_components_mask;
   IDComponentsMask previously_visible_components_mask;
 
@@ -289,6 +289,12 @@ struct OperationNode : public Node {
   /* (OperationFlag) extra settings affecting evaluation. */
   int flag;
 
+  /* Estimated evaluation time in seconds, from timings of previous evaluations. */
+  float eval_cost;
+  /* Estimated time of the longest chain of operations starting with this one, used to start
+   * operations on the critical path first. See #deg_eval_critical_path_update. */
+  float critical_path_cost;
+
   DEG_DEPSNODE_DECLARE;
 };
 
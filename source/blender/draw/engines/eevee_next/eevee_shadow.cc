@@ -550,6 +550,24 @@ ShadowModule::ShadowModule(Instance &inst, ShadowSceneData &data) : inst_(inst),
   }
 }
 
+int ShadowModule::page_pool_len_adapt(int page_used_count, int budget_page_len) const
+{
+  /* Statistics are not available yet (or nothing is visible). Keep the current pool. */
+  if (page_used_count <= 0) {
+    return min_ii(shadow_page_len_, budget_page_len);
+  }
+  /* Grow to fit the used pages with some headroom as soon as the pool overflows. Only shrink when
+   * the pool is largely unused to avoid re-allocating the atlas (and re-rendering every shadow)
+   * when the usage varies slightly between redraws. */
+  int page_len = shadow_page_len_;
+  if (page_used_count > shadow_page_len_ || page_used_count * 4 < shadow_page_len_) {
+    page_len = page_used_count + page_used_count / 2;
+  }
+  /* Round to whole atlas layers as these are allocated anyway. */
+  page_len = int(ceil_to_multiple_u(uint(page_len), SHADOW_PAGE_PER_LAYER));
+  return min_ii(max_ii(page_len, SHADOW_PAGE_PER_LAYER), budget_page_len);
+}
+
 void ShadowModule::init()
 {
   /* Temp: Disable TILE_COPY path while efficient solution for parameter buffer overflow is
@@ -593,29 +611,11 @@ void ShadowModule::init()
   /* Pool size is in MBytes. */
   const size_t pool_byte_size = enabled_ ? scene.eevee.shadow_pool_size * square_i(1024) : 1;
   const size_t page_byte_size = square_i(shadow_page_size_) * sizeof(int);
-  shadow_page_len_ = int(divide_ceil_ul(pool_byte_size, page_byte_size));
-  shadow_page_len_ = min_ii(shadow_page_len_, SHADOW_MAX_PAGE);
-
-  const int2 atlas_extent = shadow_page_size_ * int2(SHADOW_PAGE_PER_ROW);
-  const int atlas_layers = divide_ceil_u(shadow_page_len_, SHADOW_PAGE_PER_LAYER);
-
-  eGPUTextureUsage tex_usage = GPU_TEXTURE_USAGE_SHADER_READ | GPU_TEXTURE_USAGE_SHADER_WRITE;
-  if (ShadowModule::shadow_technique == ShadowTechnique::ATOMIC_RASTER) {
-    tex_usage |= GPU_TEXTURE_USAGE_ATOMIC;
-  }
-  if (atlas_tx_.ensure_2d_array(atlas_type, atlas_extent, atlas_layers, tex_usage)) {
-    /* Global update. */
-    do_full_update_ = true;
-  }
-
-  /* Make allocation safe. Avoids crash later on. */
-  if (!atlas_tx_.is_valid()) {
-    atlas_tx_.ensure_2d_array(ShadowModule::atlas_type, int2(1), 1);
-    inst_.info_append_i18n(
-        "Error: Could not allocate shadow atlas. Most likely out of GPU memory.");
-  }
+  int budget_page_len = int(divide_ceil_ul(pool_byte_size, page_byte_size));
+  budget_page_len = min_ii(budget_page_len, SHADOW_MAX_PAGE);
 
   /* Read end of the swap-chain to avoid stall. */
+  ShadowStatistics stats = {};
   if (inst_.is_viewport()) {
     if (inst_.sampling.finished_viewport()) {
       /* Swap enough to read the last one. */
@@ -627,20 +627,49 @@ void ShadowModule::init()
       statistics_buf_.swap();
     }
     statistics_buf_.current().read();
-    ShadowStatistics stats = statistics_buf_.current();
+    stats = statistics_buf_.current();
 
-    if (stats.page_used_count > shadow_page_len_ && enabled_) {
+    if (stats.page_used_count > budget_page_len && enabled_) {
       inst_.info_append_i18n(
           "Error: Shadow buffer full, may result in missing shadows and lower "
           "performance. ({} / {})",
           stats.page_used_count,
-          shadow_page_len_);
+          budget_page_len);
     }
     if (stats.view_needed_count > SHADOW_VIEW_MAX && enabled_) {
       inst_.info_append_i18n("Error: Too many shadow updates, some shadow might be incorrect.");
     }
   }
 
+  /* The pool size set by the user is a budget. In the viewport, the atlas only allocates the
+   * pages that are used, with some headroom. Final renders always use the whole budget as the
+   * statistics are not read back between samples. */
+  if (inst_.is_viewport() && enabled_) {
+    shadow_page_len_ = page_pool_len_adapt(stats.page_used_count, budget_page_len);
+  }
+  else {
+    shadow_page_len_ = budget_page_len;
+  }
+
+  const int2 atlas_extent = shadow_page_size_ * int2(SHADOW_PAGE_PER_ROW);
+  const int atlas_layers = divide_ceil_u(shadow_page_len_, SHADOW_PAGE_PER_LAYER);
+
+  eGPUTextureUsage tex_usage = GPU_TEXTURE_USAGE_SHADER_READ | GPU_TEXTURE_USAGE_SHADER_WRITE;
+  if (ShadowModule::shadow_technique == ShadowTechnique::ATOMIC_RASTER) {
+    tex_usage |= GPU_TEXTURE_USAGE_ATOMIC;
+  }
+  if (atlas_tx_.ensure_2d_array(atlas_type, atlas_extent, atlas_layers, tex_usage)) {
+    /* Global update. */
+    do_full_update_ = true;
+  }
+
+  /* Make allocation safe. Avoids crash later on. */
+  if (!atlas_tx_.is_valid()) {
+    atlas_tx_.ensure_2d_array(ShadowModule::atlas_type, int2(1), 1);
+    inst_.info_append_i18n(
+        "Error: Could not allocate shadow atlas. Most likely out of GPU memory.");
+  }
+
   atlas_tx_.filter_mode(false);
 
   /* Create different viewport to support different update region size. The most fitting viewport
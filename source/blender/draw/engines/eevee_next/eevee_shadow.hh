@@ -309,7 +309,10 @@ class ShadowModule {
   float global_lod_bias_ = 0.0f;
   /** For now, needs to be hardcoded. */
   int shadow_page_size_ = SHADOW_PAGE_RES;
-  /** Maximum number of allocated pages. Maximum value is SHADOW_MAX_TILEMAP. */
+  /**
+   * Number of allocated pages. Maximum value is SHADOW_MAX_TILEMAP.
+   * In the viewport, this adapts to the page usage within the pool size set by the user.
+   */
   int shadow_page_len_ = SHADOW_MAX_TILEMAP;
   /** Global switch. */
   bool enabled_ = true;
@@ -378,6 +381,9 @@ class ShadowModule {
 
   /* Returns the maximum number of view per shadow projection for a single update loop. */
   int max_view_per_tilemap();
+
+  /* Returns the number of pages to allocate given the last known page usage. */
+  int page_pool_len_adapt(int page_used_count, int budget_page_len) const;
 };
 
 /** \} */
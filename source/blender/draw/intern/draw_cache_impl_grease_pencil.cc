@@ -1038,12 +1038,14 @@ static void grease_pencil_geom_batch_ensure(Object &object,
       ed::greasepencil::retrieve_visible_drawings(scene, grease_pencil, true);
 
   /* First, count how many vertices and triangles are needed for the whole object. Also record the
-   * offsets into the curves for the vertices and triangles. */
+   * offsets into the curves for the vertices and triangles, and the offsets of the triangles of
+   * each stroke in the index buffer, so that the buffers can be filled in parallel. */
   int total_verts_num = 0;
   int total_triangles_num = 0;
   int v_offset = 0;
   Vector<Array<int>> verts_start_offsets_per_visible_drawing;
   Vector<Array<int>> tris_start_offsets_per_visible_drawing;
+  Vector<Array<int>> ibo_tris_start_offsets_per_visible_drawing;
   for (const ed::greasepencil::DrawingInfo &info : drawings) {
     const bke::CurvesGeometry &curves = info.drawing.strokes();
     const OffsetIndices<int> points_by_curve = curves.evaluated_points_by_curve();
@@ -1057,44 +1059,46 @@ static void grease_pencil_geom_batch_ensure(Object &object,
     const int tris_start_offsets_size = num_curves;
     Array<int> verts_start_offsets(verts_start_offsets_size);
     Array<int> tris_start_offsets(tris_start_offsets_size);
+    Array<int> ibo_tris_start_offsets(num_curves);
 
-    /* Calculate the triangle offsets for all the visible curves. */
+    /* Calculate the triangle and vertex offsets for all the visible curves. The triangle offsets
+     * into the drawing triangles also account for the hidden curves before each visible one. */
     int t_offset = 0;
-    int pos = 0;
-    for (const int curve_i : curves.curves_range()) {
-      IndexRange points = points_by_curve[curve_i];
-      if (visible_strokes.contains(curve_i)) {
-        tris_start_offsets[pos] = t_offset;
-        pos++;
-      }
-      if (points.size() >= 3) {
-        t_offset += points.size() - 2;
-      }
-    }
-
-    /* Calculate the vertex offsets for all the visible curves. */
+    int next_curve_i = 0;
     int num_cyclic = 0;
     int num_points = 0;
     visible_strokes.foreach_index([&](const int curve_i, const int pos) {
+      for (const int other_curve_i : IndexRange::from_begin_end(next_curve_i, curve_i)) {
+        t_offset += math::max(int(points_by_curve[other_curve_i].size()) - 2, 0);
+      }
+      next_curve_i = curve_i + 1;
+
       IndexRange points = points_by_curve[curve_i];
       const bool is_cyclic = cyclic[curve_i] && (points.size() > 2);
+      const int fill_tris_num = math::max(int(points.size()) - 2, 0);
 
       if (is_cyclic) {
         num_cyclic++;
       }
 
+      tris_start_offsets[pos] = t_offset;
+      t_offset += fill_tris_num;
+
       verts_start_offsets[pos] = v_offset;
       v_offset += 1 + points.size() + (is_cyclic ? 1 : 0) + 1;
       num_points += points.size();
+
+      /* Fill triangles first, then a quad for each point. */
+      ibo_tris_start_offsets[pos] = total_triangles_num;
+      total_triangles_num += fill_tris_num + (points.size() + (is_cyclic ? 1 : 0)) * 2;
     });
 
     /* One vertex is stored before and after as padding. Cyclic strokes have one extra vertex. */
     total_verts_num += num_points + num_cyclic + num_curves * 2;
-    total_triangles_num += (num_points + num_cyclic) * 2;
-    total_triangles_num += info.drawing.triangles().size();
 
     verts_start_offsets_per_visible_drawing.append(std::move(verts_start_offsets));
     tris_start_offsets_per_visible_drawing.append(std::move(tris_start_offsets));
+    ibo_tris_start_offsets_per_visible_drawing.append(std::move(ibo_tris_start_offsets));
   }
 
   GPUUsageType vbo_flag = GPU_USAGE_STATIC | GPU_USAGE_FLAG_BUFFER_TEXTURE_ONLY;
@@ -1112,6 +1116,7 @@ static void grease_pencil_geom_batch_ensure(Object &object,
   MutableSpan<GreasePencilColorVert> cols = cache->vbo_col->data<GreasePencilColorVert>();
   /* Create IBO. */
   GPU_indexbuf_init(&ibo, GPU_PRIM_TRIS, total_triangles_num, 0xFFFFFFFFu);
+  MutableSpan<uint3> ibo_tris = GPU_indexbuf_get_data(&ibo).cast<uint3>();
 
   /* Fill buffers with data. */
   for (const int drawing_i : drawings.index_range()) {
@@ -1165,6 +1170,7 @@ static void grease_pencil_geom_batch_ensure(Object &object,
     const Span<float4x2> texture_matrices = info.drawing.texture_matrices();
     const Span<int> verts_start_offsets = verts_start_offsets_per_visible_drawing[drawing_i];
     const Span<int> tris_start_offsets = tris_start_offsets_per_visible_drawing[drawing_i];
+    const Span<int> ibo_tris_start_offsets = ibo_tris_start_offsets_per_visible_drawing[drawing_i];
     IndexMaskMemory memory;
     const IndexMask visible_strokes = ed::greasepencil::retrieve_visible_strokes(
         object, info.drawing, memory);
@@ -1180,7 +1186,8 @@ static void grease_pencil_geom_batch_ensure(Object &object,
                               float u_stroke,
                               const float4x2 &texture_matrix,
                               GreasePencilStrokeVert &s_vert,
-                              GreasePencilColorVert &c_vert) {
+                              GreasePencilColorVert &c_vert,
+                              MutableSpan<uint3> point_tris) {
       const float3 pos = math::transform_point(layer_space_to_object_space, positions[point_i]);
       copy_v3_v3(s_vert.pos, pos);
       /* GP data itself does not constrain radii to be positive, but drawing code expects it, and
@@ -1205,12 +1212,12 @@ static void grease_pencil_geom_batch_ensure(Object &object,
       copy_v4_v4(c_vert.fcol, stroke_fill_colors[curve_i]);
       c_vert.fcol[3] = (int(c_vert.fcol[3] * 10000.0f) * 10.0f) + fill_opacities[curve_i];
 
-      int v_mat = (verts_range[idx] << GP_VERTEX_ID_SHIFT) | GP_IS_STROKE_VERTEX_BIT;
-      GPU_indexbuf_add_tri_verts(&ibo, v_mat + 0, v_mat + 1, v_mat + 2);
-      GPU_indexbuf_add_tri_verts(&ibo, v_mat + 2, v_mat + 1, v_mat + 3);
+      const uint v_mat = (verts_range[idx] << GP_VERTEX_ID_SHIFT) | GP_IS_STROKE_VERTEX_BIT;
+      point_tris[0] = uint3(v_mat + 0, v_mat + 1, v_mat + 2);
+      point_tris[1] = uint3(v_mat + 2, v_mat + 1, v_mat + 3);
     };
 
-    visible_strokes.foreach_index([&](const int curve_i, const int pos) {
+    visible_strokes.foreach_index(GrainSize(512), [&](const int curve_i, const int pos) {
       const IndexRange points = points_by_curve[curve_i];
       const bool is_cyclic = cyclic[curve_i] && (points.size() > 2);
       const int verts_start_offset = verts_start_offsets[pos];
@@ -1226,16 +1233,21 @@ static void grease_pencil_geom_batch_ensure(Object &object,
       /* First vertex is not drawn. */
       verts_slice.first().mat = -1;
 
+      const int fill_tris_num = math::max(int(points.size()) - 2, 0);
+      MutableSpan<uint3> stroke_tris = ibo_tris.slice(
+          ibo_tris_start_offsets[pos], fill_tris_num + (num_verts - 2) * 2);
+
       /* If the stroke has more than 2 points, add the triangle indices to the index buffer. */
-      if (points.size() >= 3) {
-        const Span<uint3> tris_slice = triangles.slice(tris_start_offset, points.size() - 2);
-        for (const uint3 tri : tris_slice) {
-          GPU_indexbuf_add_tri_verts(&ibo,
-                                     (verts_range[1] + tri.x) << GP_VERTEX_ID_SHIFT,
-                                     (verts_range[1] + tri.y) << GP_VERTEX_ID_SHIFT,
-                                     (verts_range[1] + tri.z) << GP_VERTEX_ID_SHIFT);
+      if (fill_tris_num > 0) {
+        const Span<uint3> tris_slice = triangles.slice(tris_start_offset, fill_tris_num);
+        for (const int i : tris_slice.index_range()) {
+          const uint3 tri = tris_slice[i];
+          stroke_tris[i] = uint3((verts_range[1] + tri.x) << GP_VERTEX_ID_SHIFT,
+                                 (verts_range[1] + tri.y) << GP_VERTEX_ID_SHIFT,
+                                 (verts_range[1] + tri.z) << GP_VERTEX_ID_SHIFT);
         }
       }
+      MutableSpan<uint3> points_tris = stroke_tris.drop_front(fill_tris_num);
 
       /* Write all the point attributes to the vertex buffers. Create a quad for each point. */
       const float u_scale = u_scales[curve_i];
@@ -1252,7 +1264,8 @@ static void grease_pencil_geom_batch_ensure(Object &object,
                        u_stroke,
                        texture_matrix,
                        verts_slice[idx],
-                       cols_slice[idx]);
+                       cols_slice[idx],
+                       points_tris.slice(i * 2, 2));
       }
 
       if (is_cyclic) {
@@ -1268,7 +1281,8 @@ static void grease_pencil_geom_batch_ensure(Object &object,
                        u_stroke,
                        texture_matrix,
                        verts_slice[idx],
-                       cols_slice[idx]);
+                       cols_slice[idx],
+                       points_tris.slice(points.size() * 2, 2));
       }
 
       /* Last vertex is not drawn. */
@@ -1282,8 +1296,18 @@ static void grease_pencil_geom_batch_ensure(Object &object,
   /* Also mark first vert as invalid. */
   verts[0].mat = -1;
 
-  /* Finish the IBO. */
-  cache->ibo = GPU_indexbuf_build(&ibo);
+  /* Finish the IBO. The indices are written directly, so the range is not tracked by the builder.
+   * Stroke vertex indices have #GP_IS_STROKE_VERTEX_BIT set which prevents using 16-bit indices
+   * anyway, so use a conservative range. */
+  cache->ibo = GPU_indexbuf_calloc();
+  if (total_triangles_num == 0) {
+    GPU_indexbuf_build_in_place_ex(&ibo, 1, 0, false, cache->ibo);
+  }
+  else {
+    const uint index_max = (uint(total_verts_num + 2) << GP_VERTEX_ID_SHIFT) |
+                           GP_IS_STROKE_VERTEX_BIT;
+    GPU_indexbuf_build_in_place_ex(&ibo, 0, index_max, false, cache->ibo);
+  }
   /* Create the batches */
   cache->geom_batch = GPU_batch_create(GPU_PRIM_TRIS, cache->vbo, cache->ibo);
   /* Allow creation of buffer texture. */
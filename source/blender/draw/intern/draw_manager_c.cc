@@ -1052,9 +1052,12 @@ static void drw_engines_cache_init()
       DST.text_store_p = &data->text_draw_cache;
     }
 
+    data->sync_time_accum = 0.0;
+    PROFILE_START(stime);
     if (engine->cache_init) {
       engine->cache_init(data);
     }
+    PROFILE_END_ACCUM(data->sync_time_accum, stime);
   }
 }
 
@@ -1086,7 +1089,12 @@ static void drw_engines_cache_populate(Object *ob)
     drw_batch_cache_validate(ob);
   }
 
+  /* Timing every object is not free, only do it when the statistics are displayed. */
+  const bool do_profile = DRW_stats_is_enabled();
+
   DRW_ENABLED_ENGINE_ITER (DST.view_data_active, engine, data) {
+    double stime = do_profile ? BLI_time_now_seconds() : 0.0;
+
     if (engine->id_update) {
       engine->id_update(data, &ob->id);
     }
@@ -1094,12 +1102,20 @@ static void drw_engines_cache_populate(Object *ob)
     if (engine->cache_populate) {
       engine->cache_populate(data, ob);
     }
+
+    if (do_profile) {
+      PROFILE_END_ACCUM(data->sync_time_accum, stime);
+    }
   }
 
   /* TODO: in the future it would be nice to generate once for all viewports.
    * But we need threaded DRW manager first. */
   if (!DST.dupli_source) {
+    double stime = do_profile ? BLI_time_now_seconds() : 0.0;
     drw_batch_cache_generate_requested(ob);
+    if (do_profile) {
+      PROFILE_END_ACCUM(DST.extraction_time_accum, stime);
+    }
   }
 
   /* ... and clearing it here too because this draw data is
@@ -1110,9 +1126,13 @@ static void drw_engines_cache_populate(Object *ob)
 static void drw_engines_cache_finish()
 {
   DRW_ENABLED_ENGINE_ITER (DST.view_data_active, engine, data) {
+    PROFILE_START(stime);
     if (engine->cache_finish) {
       engine->cache_finish(data);
     }
+    PROFILE_END_ACCUM(data->sync_time_accum, stime);
+    data->sync_time = (data->sync_time * (1.0 - PROFILE_TIMER_FALLOFF)) +
+                      (data->sync_time_accum * PROFILE_TIMER_FALLOFF);
   }
 
   DRW_manager_end_sync();
@@ -1748,12 +1768,20 @@ void DRW_draw_render_loop_ex(Depsgraph *depsgraph,
     drw_duplidata_free();
     drw_engines_cache_finish();
 
-    drw_task_graph_deinit();
+    {
+      /* Extraction tasks are only executed here. */
+      PROFILE_START(extraction_stime);
+      drw_task_graph_deinit();
+      PROFILE_END_ACCUM(DST.extraction_time_accum, extraction_stime);
+    }
     DRW_render_instance_buffer_finish();
 
 #ifdef USE_PROFILE
     double *cache_time = DRW_view_data_cache_time_get(DST.view_data_active);
     PROFILE_END_UPDATE(*cache_time, stime);
+    double *extraction_time = DRW_view_data_extraction_time_get(DST.view_data_active);
+    *extraction_time = (*extraction_time * (1.0 - PROFILE_TIMER_FALLOFF)) +
+                       (DST.extraction_time_accum * PROFILE_TIMER_FALLOFF);
 #endif
   }
 
@@ -658,6 +658,10 @@ struct DRWManager {
   /** True, when drawing is in progress, see #DRW_draw_in_progress. */
   bool in_progress;
 
+  /** Time spent in batch cache extraction during the current redraw (in ms).
+   * Only measured when #DRW_stats_is_enabled. */
+  double extraction_time_accum;
+
   DRWView *view_default;
   DRWView *view_active;
   DRWView *view_previous;
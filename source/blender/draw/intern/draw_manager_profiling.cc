@@ -62,9 +62,14 @@ void DRW_stats_free()
   }
 }
 
+bool DRW_stats_is_enabled()
+{
+  return G.debug_value > 20 && G.debug_value < 30;
+}
+
 void DRW_stats_begin()
 {
-  if (G.debug_value > 20 && G.debug_value < 30) {
+  if (DRW_stats_is_enabled()) {
     DTP.is_recording = true;
   }
 
@@ -215,7 +220,8 @@ void DRW_stats_draw(const rcti *rect)
   int lvl_index[MAX_NESTED_TIMER];
   int v = 0, u = 0;
 
-  double init_tot_time = 0.0, background_tot_time = 0.0, render_tot_time = 0.0, tot_time = 0.0;
+  double init_tot_time = 0.0, sync_tot_time = 0.0, background_tot_time = 0.0,
+         render_tot_time = 0.0, tot_time = 0.0;
 
   int fontid = BLF_default();
   UI_FontThemeColor(fontid, TH_TEXT_HI);
@@ -230,6 +236,8 @@ void DRW_stats_draw(const rcti *rect)
   draw_stat_5row(rect, u++, v, col_label, sizeof(col_label));
   STRNCPY(col_label, "Init");
   draw_stat_5row(rect, u++, v, col_label, sizeof(col_label));
+  STRNCPY(col_label, "Sync");
+  draw_stat_5row(rect, u++, v, col_label, sizeof(col_label));
   STRNCPY(col_label, "Background");
   draw_stat_5row(rect, u++, v, col_label, sizeof(col_label));
   STRNCPY(col_label, "Render");
@@ -249,6 +257,10 @@ void DRW_stats_draw(const rcti *rect)
     SNPRINTF(time_to_txt, "%.2fms", data->init_time);
     draw_stat_5row(rect, u++, v, time_to_txt, sizeof(time_to_txt));
 
+    sync_tot_time += data->sync_time;
+    SNPRINTF(time_to_txt, "%.2fms", data->sync_time);
+    draw_stat_5row(rect, u++, v, time_to_txt, sizeof(time_to_txt));
+
     background_tot_time += data->background_time;
     SNPRINTF(time_to_txt, "%.2fms", data->background_time);
     draw_stat_5row(rect, u++, v, time_to_txt, sizeof(time_to_txt));
@@ -257,8 +269,10 @@ void DRW_stats_draw(const rcti *rect)
     SNPRINTF(time_to_txt, "%.2fms", data->render_time);
     draw_stat_5row(rect, u++, v, time_to_txt, sizeof(time_to_txt));
 
-    tot_time += data->init_time + data->background_time + data->render_time;
-    SNPRINTF(time_to_txt, "%.2fms", data->init_time + data->background_time + data->render_time);
+    const double engine_tot_time = data->init_time + data->sync_time + data->background_time +
+                                   data->render_time;
+    tot_time += engine_tot_time;
+    SNPRINTF(time_to_txt, "%.2fms", engine_tot_time);
     draw_stat_5row(rect, u++, v, time_to_txt, sizeof(time_to_txt));
     v++;
   }
@@ -269,6 +283,8 @@ void DRW_stats_draw(const rcti *rect)
   draw_stat_5row(rect, u++, v, col_label, sizeof(col_label));
   SNPRINTF(time_to_txt, "%.2fms", init_tot_time);
   draw_stat_5row(rect, u++, v, time_to_txt, sizeof(time_to_txt));
+  SNPRINTF(time_to_txt, "%.2fms", sync_tot_time);
+  draw_stat_5row(rect, u++, v, time_to_txt, sizeof(time_to_txt));
   SNPRINTF(time_to_txt, "%.2fms", background_tot_time);
   draw_stat_5row(rect, u++, v, time_to_txt, sizeof(time_to_txt));
   SNPRINTF(time_to_txt, "%.2fms", render_tot_time);
@@ -283,6 +299,14 @@ void DRW_stats_draw(const rcti *rect)
   draw_stat_5row(rect, u++, v, col_label, sizeof(col_label));
   SNPRINTF(time_to_txt, "%.2fms", *cache_time);
   draw_stat_5row(rect, u++, v, time_to_txt, sizeof(time_to_txt));
+  v++;
+
+  u = 0;
+  double *extraction_time = DRW_view_data_extraction_time_get(DST.view_data_active);
+  STRNCPY(col_label, "Extraction");
+  draw_stat_5row(rect, u++, v, col_label, sizeof(col_label));
+  SNPRINTF(time_to_txt, "%.2fms", *extraction_time);
+  draw_stat_5row(rect, u++, v, time_to_txt, sizeof(time_to_txt));
   v += 2;
 
   /* ------------------------------------------ */
@@ -10,6 +10,9 @@
 
 struct rcti;
 
+/** Are draw statistics requested (debug value between 21 and 29). */
+bool DRW_stats_is_enabled();
+
 void DRW_stats_free();
 void DRW_stats_begin();
 void DRW_stats_reset();
@@ -285,6 +285,29 @@ static void drw_deferred_queue_append(GPUMaterial *mat, bool is_optimization_job
   WM_jobs_start(wm, wm_job);
 }
 
+/**
+ * Move an already queued material to the end of the compilation queue. The queue is processed
+ * from its end, so materials which are still requested by the redraws of the current view get
+ * compiled before materials which were queued earlier but are not visible anymore.
+ */
+static void drw_deferred_shader_prioritize(GPUMaterial *mat)
+{
+  wmWindowManager *wm = CTX_wm_manager(DST.draw_ctx.evil_C);
+  DRWShaderCompiler *comp = (DRWShaderCompiler *)WM_jobs_customdata_from_type(
+      wm, wm, WM_JOB_TYPE_SHADER_COMPILATION);
+  if (comp == nullptr) {
+    return;
+  }
+
+  BLI_spin_lock(&comp->list_lock);
+  LinkData *link = (LinkData *)BLI_findptr(&comp->queue, mat, offsetof(LinkData, data));
+  if (link && link != comp->queue.last) {
+    BLI_remlink(&comp->queue, link);
+    BLI_addtail(&comp->queue, link);
+  }
+  BLI_spin_unlock(&comp->list_lock);
+}
+
 static void drw_deferred_shader_add(GPUMaterial *mat, bool deferred)
 {
   if (ELEM(GPU_material_status(mat), GPU_MAT_SUCCESS, GPU_MAT_FAILED)) {
@@ -318,6 +341,7 @@ static void drw_deferred_shader_add(GPUMaterial *mat, bool deferred)
 
   /* Don't add material to the queue twice. */
   if (GPU_material_status(mat) == GPU_MAT_QUEUED) {
+    drw_deferred_shader_prioritize(mat);
     return;
   }
 
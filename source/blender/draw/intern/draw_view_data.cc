@@ -36,6 +36,7 @@ struct DRWViewData {
   int texture_list_size[2] = {0, 0};
 
   double cache_time = 0.0;
+  double extraction_time = 0.0;
 
   Vector<ViewportEngineData> engines;
   Vector<ViewportEngineData *> enabled_engines;
@@ -251,6 +252,11 @@ double *DRW_view_data_cache_time_get(DRWViewData *view_data)
   return &view_data->cache_time;
 }
 
+double *DRW_view_data_extraction_time_get(DRWViewData *view_data)
+{
+  return &view_data->extraction_time;
+}
+
 DefaultFramebufferList *DRW_view_data_default_framebuffer_list_get(DRWViewData *view_data)
 {
   return &view_data->dfbl;
@@ -66,6 +66,10 @@ struct ViewportEngineData {
   double init_time;
   double render_time;
   double background_time;
+  /** Time spent in the cache callbacks (init, populate and finish). */
+  double sync_time;
+  /** Sync time of the current redraw, only accumulated when #DRW_stats_is_enabled. */
+  double sync_time_accum;
 };
 
 struct ViewportEngineData_Info {
@@ -118,6 +122,8 @@ void DRW_view_data_reset(DRWViewData *view_data);
 void DRW_view_data_free_unused(DRWViewData *view_data);
 void DRW_view_data_engines_view_update(DRWViewData *view_data);
 double *DRW_view_data_cache_time_get(DRWViewData *view_data);
+/** Part of the cache time spent extracting the GPU batches of objects. */
+double *DRW_view_data_extraction_time_get(DRWViewData *view_data);
 DefaultFramebufferList *DRW_view_data_default_framebuffer_list_get(DRWViewData *view_data);
 DefaultTextureList *DRW_view_data_default_texture_list_get(DRWViewData *view_data);
 
@@ -20,6 +20,7 @@
 #include "BLI_memarena.h"
 #include "BLI_ordered_edge.hh"
 #include "BLI_string.h"
+#include "BLI_task.hh"
 
 #include "BLT_translation.hh"
 
@@ -991,43 +992,56 @@ static void harmonic_ray_callback(void *userdata,
   }
 }
 
-static MDefBoundIsect *meshdeform_ray_tree_intersect(MeshDeformBind *mdb,
-                                                     const float co1[3],
-                                                     const float co2[3])
+/**
+ * Find the first intersection of the segment from \a co1 to \a co2 with the cage.
+ * Doesn't allocate, so it can be used from multiple threads.
+ */
+static bool meshdeform_ray_tree_cast(MeshDeformBind *mdb,
+                                     const float co1[3],
+                                     const float co2[3],
+                                     MeshDeformIsect *r_isect_mdef,
+                                     BVHTreeRayHit *r_hit)
 {
-  BVHTreeRayHit hit;
-  MeshDeformIsect isect_mdef;
   MeshRayCallbackData data = {
       mdb,
-      &isect_mdef,
+      r_isect_mdef,
   };
   float end[3], vec_normal[3];
 
   /* happens binding when a cage has no faces */
   if (UNLIKELY(mdb->bvhtree == nullptr)) {
-    return nullptr;
+    return false;
   }
 
   /* setup isec */
-  memset(&isect_mdef, 0, sizeof(isect_mdef));
-  isect_mdef.lambda = 1e10f;
+  memset(r_isect_mdef, 0, sizeof(*r_isect_mdef));
+  r_isect_mdef->lambda = 1e10f;
 
-  copy_v3_v3(isect_mdef.start, co1);
+  copy_v3_v3(r_isect_mdef->start, co1);
   copy_v3_v3(end, co2);
-  sub_v3_v3v3(isect_mdef.vec, end, isect_mdef.start);
-  isect_mdef.vec_length = normalize_v3_v3(vec_normal, isect_mdef.vec);
+  sub_v3_v3v3(r_isect_mdef->vec, end, r_isect_mdef->start);
+  r_isect_mdef->vec_length = normalize_v3_v3(vec_normal, r_isect_mdef->vec);
+
+  r_hit->index = -1;
+  r_hit->dist = BVH_RAYCAST_DIST_MAX;
+  return BLI_bvhtree_ray_cast_ex(mdb->bvhtree,
+                                 r_isect_mdef->start,
+                                 vec_normal,
+                                 0.0,
+                                 r_hit,
+                                 harmonic_ray_callback,
+                                 &data,
+                                 BVH_RAYCAST_WATERTIGHT) != -1;
+}
 
-  hit.index = -1;
-  hit.dist = BVH_RAYCAST_DIST_MAX;
-  if (BLI_bvhtree_ray_cast_ex(mdb->bvhtree,
-                              isect_mdef.start,
-                              vec_normal,
-                              0.0,
-                              &hit,
-                              harmonic_ray_callback,
-                              &data,
-                              BVH_RAYCAST_WATERTIGHT) != -1)
-  {
+static MDefBoundIsect *meshdeform_ray_tree_intersect(MeshDeformBind *mdb,
+                                                     const float co1[3],
+                                                     const float co2[3])
+{
+  BVHTreeRayHit hit;
+  MeshDeformIsect isect_mdef;
+
+  if (meshdeform_ray_tree_cast(mdb, co1, co2, &isect_mdef, &hit)) {
     const blender::Span<int> corner_verts = mdb->cagemesh_cache.corner_verts;
     const int face_i = mdb->cagemesh_cache.tri_faces[hit.index];
     const blender::IndexRange face = mdb->cagemesh_cache.faces[face_i];
@@ -1066,9 +1080,10 @@ static MDefBoundIsect *meshdeform_ray_tree_intersect(MeshDeformBind *mdb,
   return nullptr;
 }
 
-static int meshdeform_inside_cage(MeshDeformBind *mdb, float *co)
+static int meshdeform_inside_cage(MeshDeformBind *mdb, const float *co)
 {
-  MDefBoundIsect *isect;
+  BVHTreeRayHit hit;
+  MeshDeformIsect isect_mdef;
   float outside[3], start[3], dir[3];
   int i;
 
@@ -1081,8 +1096,7 @@ static int meshdeform_inside_cage(MeshDeformBind *mdb, float *co)
     sub_v3_v3v3(dir, outside, start);
     normalize_v3(dir);
 
-    isect = meshdeform_ray_tree_intersect(mdb, start, outside);
-    if (isect && !isect->facing) {
+    if (meshdeform_ray_tree_cast(mdb, start, outside, &isect_mdef, &hit) && !isect_mdef.isect) {
       return 1;
     }
   }
@@ -1584,8 +1598,8 @@ static void harmonic_coordinates_bind(MeshDeformModifierData *mmd, MeshDeformBin
   MDefBindInfluence *inf;
   MDefInfluence *mdinf;
   MDefCell *cell;
-  float center[3], vec[3], maxwidth, totweight;
-  int a, b, x, y, z, totinside, offset;
+  float center[3], maxwidth, totweight;
+  int a, b, x, y, z, offset;
 
   /* compute bounding box of the cage mesh */
   INIT_MINMAX(mdb->min, mdb->max);
@@ -1654,15 +1668,12 @@ static void harmonic_coordinates_bind(MeshDeformModifierData *mmd, MeshDeformBin
 
   progress_bar(0, "Setting up mesh deform system");
 
-  totinside = 0;
-  for (a = 0; a < mdb->verts_num; a++) {
-    copy_v3_v3(vec, mdb->vertexcos[a]);
-    mdb->inside[a] = meshdeform_inside_cage(mdb, vec);
-    if (mdb->inside[a]) {
-      totinside++;
-    }
-  }
-  (void)totinside; /* Quiet set-but-unused warning (may be removed). */
+  blender::threading::parallel_for(
+      blender::IndexRange(mdb->verts_num), 256, [&](const blender::IndexRange range) {
+        for (const int vert : range) {
+          mdb->inside[vert] = meshdeform_inside_cage(mdb, mdb->vertexcos[vert]);
+        }
+      });
 
   /* free temporary MDefBoundIsects */
   BLI_memarena_free(mdb->memarena);
@@ -6924,12 +6924,11 @@ void calc_brush_distances_squared(const SculptSession &ss,
     /* The tube falloff shape requires the cached view normal. */
     const float3 &view_normal = ss.cache ? ss.cache->view_normal_symm :
                                            ss.filter_cache->view_normal;
-    float4 test_plane;
-    plane_from_point_normal_v3(test_plane, test_location, view_normal);
+    /* Project onto the view plane inline rather than with #closest_to_plane_normalized_v3,
+     * keeping the loop free of calls so it can be vectorized. */
     for (const int i : verts.index_range()) {
-      float3 projected;
-      closest_to_plane_normalized_v3(projected, test_plane, positions[verts[i]]);
-      r_distances[i] = math::distance_squared(projected, test_location);
+      const float3 offset = positions[verts[i]] - test_location;
+      r_distances[i] = math::length_squared(offset - view_normal * math::dot(offset, view_normal));
     }
   }
   else {
@@ -6963,12 +6962,11 @@ void calc_brush_distances_squared(const SculptSession &ss,
     /* The tube falloff shape requires the cached view normal. */
     const float3 &view_normal = ss.cache ? ss.cache->view_normal_symm :
                                            ss.filter_cache->view_normal;
-    float4 test_plane;
-    plane_from_point_normal_v3(test_plane, test_location, view_normal);
+    /* Project onto the view plane inline rather than with #closest_to_plane_normalized_v3,
+     * keeping the loop free of calls so it can be vectorized. */
     for (const int i : positions.index_range()) {
-      float3 projected;
-      closest_to_plane_normalized_v3(projected, test_plane, positions[i]);
-      r_distances[i] = math::distance_squared(projected, test_location);
+      const float3 offset = positions[i] - test_location;
+      r_distances[i] = math::length_squared(offset - view_normal * math::dot(offset, view_normal));
     }
   }
   else {
@@ -7097,14 +7095,10 @@ void apply_hardness_to_distances(const float radius,
   const float threshold = hardness * radius;
   const float radius_inv = math::rcp(radius);
   const float hardness_inv_rcp = math::rcp(1.0f - hardness);
+  /* Written without branches so the loop can be vectorized. */
   for (const int i : distances.index_range()) {
-    if (distances[i] < threshold) {
-      distances[i] = 0.0f;
-    }
-    else {
-      const float radius_factor = (distances[i] * radius_inv - hardness) * hardness_inv_rcp;
-      distances[i] = radius_factor * radius;
-    }
+    const float radius_factor = (distances[i] * radius_inv - hardness) * hardness_inv_rcp;
+    distances[i] = distances[i] < threshold ? 0.0f : radius_factor * radius;
   }
 }
 
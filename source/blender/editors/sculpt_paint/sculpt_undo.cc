@@ -993,6 +993,8 @@ static void restore_list(bContext *C, Depsgraph *depsgraph, StepData &step_data)
         return;
       }
 
+      /* Only filled for regular meshes, where it is used to update the normals partially. */
+      Array<bool> modified_verts;
       if (use_multires_undo(step_data, ss)) {
         MutableSpan<bke::pbvh::GridsNode> nodes = ss.pbvh->nodes<bke::pbvh::GridsNode>();
         SubdivCCG &subdiv_ccg = *ss.subdiv_ccg;
@@ -1016,7 +1018,8 @@ static void restore_list(bContext *C, Depsgraph *depsgraph, StepData &step_data)
         if (!restore_active_shape_key(*C, *depsgraph, step_data, object)) {
           return;
         }
-        Array<bool> modified_verts(ss.totvert, false);
+        modified_verts.reinitialize(ss.totvert);
+        modified_verts.fill(false);
         restore_position_mesh(object, step_data.nodes, modified_verts);
         node_mask.foreach_index([&](const int i) {
           if (indices_contain_true(modified_verts, bke::pbvh::node_verts(nodes[i]))) {
@@ -1027,7 +1030,15 @@ static void restore_list(bContext *C, Depsgraph *depsgraph, StepData &step_data)
 
       if (tag_update) {
         Mesh &mesh = *static_cast<Mesh *>(object.data);
-        mesh.tag_positions_changed();
+        if (modified_verts.is_empty()) {
+          mesh.tag_positions_changed();
+        }
+        else {
+          /* Undo steps usually only restore a small part of the mesh. */
+          IndexMaskMemory modified_memory;
+          mesh.tag_positions_changed_partial(
+              IndexMask::from_bools(modified_verts, modified_memory));
+        }
         BKE_sculptsession_free_deformMats(&ss);
       }
       bke::pbvh::update_bounds(*depsgraph, object, *ss.pbvh);
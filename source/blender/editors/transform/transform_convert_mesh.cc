@@ -11,6 +11,7 @@
 #include "MEM_guardedalloc.h"
 
 #include "BLI_alloca.h"
+#include "BLI_array.hh"
 #include "BLI_bitmap.h"
 #include "BLI_linklist_stack.h"
 #include "BLI_math_geom.h"
@@ -18,6 +19,7 @@
 #include "BLI_math_rotation.h"
 #include "BLI_math_vector.h"
 #include "BLI_memarena.h"
+#include "BLI_task.hh"
 #include "BLI_utildefines_stack.h"
 
 #include "BKE_context.hh"
@@ -1627,83 +1629,110 @@ static void createTransEditVerts(bContext * /*C*/, TransInfo *t)
           MEM_callocN(tc->data_len * sizeof(TransDataExtension), "TransObData ext"));
     }
 
-    TransData *tob = tc->data;
-    TransDataMirror *td_mirror = tc->data_mirror;
-    BM_ITER_MESH_INDEX (eve, &iter, bm, BM_VERTS_OF_MESH, a) {
-      if (BM_elem_flag_test(eve, BM_ELEM_HIDDEN)) {
-        continue;
+    /* Assign the output elements serially, then fill them in parallel,
+     * since this is slow for dense meshes (especially with proportional editing). */
+    BM_mesh_elem_table_ensure(bm, BM_VERT);
+    blender::Array<int> vert_td_index(bm->totvert, -1);
+    blender::Array<int> vert_td_mirror_index(bm->totvert, -1);
+    {
+      int td_index = 0;
+      int td_mirror_index = 0;
+      BM_ITER_MESH_INDEX (eve, &iter, bm, BM_VERTS_OF_MESH, a) {
+        if (BM_elem_flag_test(eve, BM_ELEM_HIDDEN)) {
+          continue;
+        }
+        if (mirror_data.vert_map && mirror_data.vert_map[a].index != -1) {
+          vert_td_mirror_index[a] = td_mirror_index++;
+        }
+        else if (prop_mode || BM_elem_flag_test(eve, BM_ELEM_SELECT)) {
+          vert_td_index[a] = td_index++;
+        }
       }
+      BLI_assert(td_index == tc->data_len);
+    }
 
-      int island_index = -1;
-      if (island_data.island_vert_map) {
-        const int connected_index = (dists_index && dists_index[a] != -1) ? dists_index[a] : a;
-        island_index = island_data.island_vert_map[connected_index];
-      }
+    blender::threading::parallel_for(
+        blender::IndexRange(bm->totvert), 1024, [&](const blender::IndexRange range) {
+          for (const int a : range) {
+            BMVert *eve = BM_vert_at_index(bm, a);
+            if (vert_td_index[a] == -1 && vert_td_mirror_index[a] == -1) {
+              continue;
+            }
 
-      if (mirror_data.vert_map && mirror_data.vert_map[a].index != -1) {
-        int elem_index = mirror_data.vert_map[a].index;
-        BMVert *v_src = BM_vert_at_index(bm, elem_index);
+            int island_index = -1;
+            if (island_data.island_vert_map) {
+              const int connected_index = (dists_index && dists_index[a] != -1) ? dists_index[a] :
+                                                                                  a;
+              island_index = island_data.island_vert_map[connected_index];
+            }
 
-        if (BM_elem_flag_test(eve, BM_ELEM_SELECT)) {
-          mirror_data.vert_map[a].flag |= TD_SELECTED;
-        }
+            if (vert_td_mirror_index[a] != -1) {
+              TransDataMirror *td_mirror = &tc->data_mirror[vert_td_mirror_index[a]];
+              int elem_index = mirror_data.vert_map[a].index;
+              BMVert *v_src = BM_vert_at_index(bm, elem_index);
 
-        td_mirror->extra = eve;
-        td_mirror->loc = eve->co;
-        copy_v3_v3(td_mirror->iloc, eve->co);
-        td_mirror->flag = mirror_data.vert_map[a].flag;
-        td_mirror->loc_src = v_src->co;
-        mesh_transdata_center_copy(&island_data, island_index, td_mirror->iloc, td_mirror->center);
-
-        td_mirror++;
-      }
-      else if (prop_mode || BM_elem_flag_test(eve, BM_ELEM_SELECT)) {
-        /* Do not use the island center in case we are using islands
-         * only to get axis for snap/rotate to normal... */
-        VertsToTransData(t, tob, tx, em, eve, &island_data, island_index);
-        if (tx) {
-          tx++;
-        }
+              if (BM_elem_flag_test(eve, BM_ELEM_SELECT)) {
+                mirror_data.vert_map[a].flag |= TD_SELECTED;
+              }
 
-        /* Selected. */
-        if (BM_elem_flag_test(eve, BM_ELEM_SELECT)) {
-          tob->flag |= TD_SELECTED;
-        }
+              td_mirror->extra = eve;
+              td_mirror->loc = eve->co;
+              copy_v3_v3(td_mirror->iloc, eve->co);
+              td_mirror->flag = mirror_data.vert_map[a].flag;
+              td_mirror->loc_src = v_src->co;
+              mesh_transdata_center_copy(
+                  &island_data, island_index, td_mirror->iloc, td_mirror->center);
+              continue;
+            }
 
-        if (prop_mode) {
-          if (prop_mode & T_PROP_CONNECTED) {
-            tob->dist = dists[a];
-          }
-          else {
-            tob->dist = FLT_MAX;
-          }
-        }
+            TransData *tob = &tc->data[vert_td_index[a]];
+            /* Do not use the island center in case we are using islands
+             * only to get axis for snap/rotate to normal... */
+            VertsToTransData(t,
+                             tob,
+                             tx ? &tx[vert_td_index[a]] : nullptr,
+                             em,
+                             eve,
+                             &island_data,
+                             island_index);
+
+            /* Selected. */
+            if (BM_elem_flag_test(eve, BM_ELEM_SELECT)) {
+              tob->flag |= TD_SELECTED;
+            }
 
-        /* CrazySpace. */
-        transform_convert_mesh_crazyspace_transdata_set(
-            mtx,
-            smtx,
-            !crazyspace_data.defmats.is_empty() ? crazyspace_data.defmats[a].ptr() : nullptr,
-            crazyspace_data.quats && BM_elem_flag_test(eve, BM_ELEM_TAG) ?
-                crazyspace_data.quats[a] :
-                nullptr,
-            tob);
+            if (prop_mode) {
+              if (prop_mode & T_PROP_CONNECTED) {
+                tob->dist = dists[a];
+              }
+              else {
+                tob->dist = FLT_MAX;
+              }
+            }
 
-        if (tc->use_mirror_axis_any) {
-          if (tc->use_mirror_axis_x && fabsf(tob->loc[0]) < TRANSFORM_MAXDIST_MIRROR) {
-            tob->flag |= TD_MIRROR_EDGE_X;
-          }
-          if (tc->use_mirror_axis_y && fabsf(tob->loc[1]) < TRANSFORM_MAXDIST_MIRROR) {
-            tob->flag |= TD_MIRROR_EDGE_Y;
-          }
-          if (tc->use_mirror_axis_z && fabsf(tob->loc[2]) < TRANSFORM_MAXDIST_MIRROR) {
-            tob->flag |= TD_MIRROR_EDGE_Z;
+            /* CrazySpace. */
+            transform_convert_mesh_crazyspace_transdata_set(
+                mtx,
+                smtx,
+                !crazyspace_data.defmats.is_empty() ? crazyspace_data.defmats[a].ptr() : nullptr,
+                crazyspace_data.quats && BM_elem_flag_test(eve, BM_ELEM_TAG) ?
+                    crazyspace_data.quats[a] :
+                    nullptr,
+                tob);
+
+            if (tc->use_mirror_axis_any) {
+              if (tc->use_mirror_axis_x && fabsf(tob->loc[0]) < TRANSFORM_MAXDIST_MIRROR) {
+                tob->flag |= TD_MIRROR_EDGE_X;
+              }
+              if (tc->use_mirror_axis_y && fabsf(tob->loc[1]) < TRANSFORM_MAXDIST_MIRROR) {
+                tob->flag |= TD_MIRROR_EDGE_Y;
+              }
+              if (tc->use_mirror_axis_z && fabsf(tob->loc[2]) < TRANSFORM_MAXDIST_MIRROR) {
+                tob->flag |= TD_MIRROR_EDGE_Z;
+              }
+            }
           }
-        }
-
-        tob++;
-      }
-    }
+        });
 
     transform_convert_mesh_islanddata_free(&island_data);
     transform_convert_mesh_mirrordata_free(&mirror_data);
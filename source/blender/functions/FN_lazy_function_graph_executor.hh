@@ -118,6 +118,13 @@ class GraphExecutor : public LazyFunction {
     int total_size;
   } init_buffer_info_;
 
+  /**
+   * Execution time of every node in nanoseconds, as a moving average over previous executions.
+   * This allows making the nodes scheduled on a thread available to other threads before an
+   * expensive node runs, even if the node does not send a #lazy_threading hint itself.
+   */
+  std::unique_ptr<std::atomic<int64_t>[]> node_durations_ns_;
+
   friend class Executor;
 
  public:
@@ -17,6 +17,8 @@ class ProcedureExecutor : public MultiFunction {
  private:
   Signature signature_;
   const Procedure &procedure_;
+  /** Number of indices for which the intermediate values of all variables fit into the cache. */
+  int64_t max_grain_size_;
 
  public:
   ProcedureExecutor(const Procedure &procedure);
@@ -55,6 +55,13 @@
 
 namespace blender::fn::lazy_function {
 
+/**
+ * Nodes that took longer than this in previous executions make the other nodes scheduled on the
+ * same thread available to other threads before they run. This is much more than the overhead of
+ * pushing a task to the task pool.
+ */
+static constexpr int64_t expensive_node_duration_ns = 100'000;
+
 enum class NodeScheduleState : uint8_t {
   /**
    * Default state of every node.
@@ -1447,13 +1454,24 @@ inline void Executor::execute_node(const FunctionNode &node,
     this->push_all_scheduled_nodes_to_task_pool(current_task);
   };
 
+  std::atomic<int64_t> &duration_ns = self_.node_durations_ns_[node.index_in_graph()];
+  if (duration_ns.load(std::memory_order_relaxed) > expensive_node_duration_ns) {
+    /* The node took a while in previous executions, so don't wait for it to send a hint. */
+    blocking_hint_fn();
+  }
+
   lazy_threading::HintReceiver blocking_hint_receiver{blocking_hint_fn};
+  const timeit::TimePoint start_time = timeit::Clock::now();
   if (self_.node_execute_wrapper_) {
     self_.node_execute_wrapper_->execute_node(node, node_params, fn_context);
   }
   else {
     fn.execute(node_params, fn_context);
   }
+  const int64_t new_duration_ns = timeit::Nanoseconds(timeit::Clock::now() - start_time).count();
+  /* Races between threads executing the same node are harmless, one of the values wins. */
+  duration_ns.store((duration_ns.load(std::memory_order_relaxed) + new_duration_ns) / 2,
+                    std::memory_order_relaxed);
 
   if (self_.logger_ != nullptr) {
     self_.logger_->log_after_node_execute(node, node_params, fn_context);
@@ -1494,6 +1512,7 @@ GraphExecutor::GraphExecutor(const Graph &graph,
   /* Preprocess buffer offsets. */
   int offset = 0;
   const Span<const Node *> nodes = graph_.nodes();
+  node_durations_ns_.reset(new std::atomic<int64_t>[nodes.size()]());
   init_buffer_info_.node_states_array_offset = offset;
   offset += sizeof(NodeState *) * nodes.size();
   init_buffer_info_.loaded_inputs_array_offset = offset;
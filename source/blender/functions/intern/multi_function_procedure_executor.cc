@@ -17,6 +17,19 @@ ProcedureExecutor::ProcedureExecutor(const Procedure &procedure) : procedure_(pr
   }
 
   this->set_signature(&signature_);
+
+  /* Chunks of a few hundred kilobytes of intermediate data mostly stay in the L2 cache, while
+   * all instructions of the procedure are executed on them. */
+  const int64_t cache_size = 256 * 1024;
+  int64_t bytes_per_index = 0;
+  for (const Variable *variable : procedure.variables()) {
+    const DataType data_type = variable->data_type();
+    bytes_per_index += data_type.is_single() ? data_type.single_type().size() :
+                                               data_type.vector_base_type().size();
+  }
+  max_grain_size_ = std::clamp<int64_t>(cache_size / std::max<int64_t>(bytes_per_index, 1),
+                                        1024,
+                                        10000);
 }
 
 using IndicesSplitVectors = std::array<Vector<int64_t>, 2>;
@@ -1246,6 +1259,7 @@ MultiFunction::ExecutionHints ProcedureExecutor::get_execution_hints() const
   ExecutionHints hints;
   hints.allocates_array = true;
   hints.min_grain_size = 10000;
+  hints.max_grain_size = max_grain_size_;
   return hints;
 }
 
@@ -7,10 +7,14 @@
 
 #include "BLI_array.hh"
 #include "BLI_bit_vector.hh"
+#include "BLI_bounds.hh"
 #include "BLI_index_mask.hh"
 #include "BLI_kdtree.h"
+#include "BLI_map.hh"
 #include "BLI_math_vector.h"
+#include "BLI_math_vector.hh"
 #include "BLI_offset_indices.hh"
+#include "BLI_sort.hh"
 #include "BLI_vector.hh"
 
 #include "BKE_customdata.hh"
@@ -1694,21 +1698,135 @@ static Mesh *create_merged_mesh(const Mesh &mesh,
 /** \name Merge Map Creation
  * \{ */
 
+/** Number of bits used for the cell coordinate along each axis in #calc_duplicates_grid. */
+static constexpr int GRID_AXIS_BITS = 21;
+/** Use the KD tree when the grid would have fewer cells along its largest axis than this. */
+static constexpr int GRID_AXIS_RESOLUTION_MIN = 16;
+
+/**
+ * Find duplicates with the same result as #BLI_kdtree_3d_calc_duplicates_fast using index order,
+ * but with a uniform grid whose cells are as large as the merge distance. When the distance is
+ * small compared to the size of the mesh, every search only has to look at the points in the
+ * neighboring cells, which is much cheaper than a KD tree range search.
+ *
+ * \return The number of merged vertices, or #std::nullopt if the grid would be too coarse or too
+ * fine to be used. In that case \a r_dest_map is left unchanged.
+ */
+static std::optional<int> calc_duplicates_grid(const Span<float3> positions,
+                                               const IndexMask &selection,
+                                               const float merge_distance,
+                                               MutableSpan<int> r_dest_map)
+{
+  if (!(merge_distance > 0.0f)) {
+    return std::nullopt;
+  }
+  const std::optional<Bounds<float3>> bounds = bounds::min_max(selection, positions);
+  if (!bounds) {
+    return std::nullopt;
+  }
+  /* Slightly larger cells, to make sure that float precision can't put points within the merge
+   * distance more than one cell apart. */
+  const float cell_size = merge_distance * 1.001f;
+  const float3 resolution = (bounds->max - bounds->min) / cell_size;
+  const float resolution_max = math::reduce_max(resolution);
+  if (resolution_max < float(GRID_AXIS_RESOLUTION_MIN) ||
+      resolution_max >= float((1 << GRID_AXIS_BITS) - 2))
+  {
+    return std::nullopt;
+  }
+
+  const auto cell_coord = [&](const float3 &position) {
+    return int3(math::floor((position - bounds->min) / cell_size));
+  };
+  const auto cell_key = [](const int3 &coord) {
+    return (uint64_t(coord.x) << (GRID_AXIS_BITS * 2)) | (uint64_t(coord.y) << GRID_AXIS_BITS) |
+           uint64_t(coord.z);
+  };
+
+  /* Sort the selected points by their cell, keeping the index order within each cell. */
+  Array<uint64_t> keys(positions.size());
+  selection.foreach_index(GrainSize(4096), [&](const int i) {
+    keys[i] = cell_key(cell_coord(positions[i]));
+  });
+  Array<int> sorted_indices(selection.size());
+  selection.to_indices<int>(sorted_indices);
+  parallel_sort(sorted_indices.begin(), sorted_indices.end(), [&](const int a, const int b) {
+    return keys[a] < keys[b] || (keys[a] == keys[b] && a < b);
+  });
+
+  Map<uint64_t, IndexRange> cells;
+  for (int64_t start = 0; start < sorted_indices.size();) {
+    const uint64_t key = keys[sorted_indices[start]];
+    int64_t end = start + 1;
+    while (end < sorted_indices.size() && keys[sorted_indices[end]] == key) {
+      end++;
+    }
+    cells.add_new(key, IndexRange::from_begin_end(start, end));
+    start = end;
+  }
+
+  /* The search itself stays in index order, since that defines which vertex becomes the target
+   * of a merge. */
+  const float merge_dist_sq = square_f(merge_distance);
+  int duplicates_num = 0;
+  selection.foreach_index([&](const int i) {
+    if (!ELEM(r_dest_map[i], OUT_OF_CONTEXT, i)) {
+      return;
+    }
+    const float3 &position = positions[i];
+    const int3 coord = cell_coord(position);
+    const int duplicates_num_prev = duplicates_num;
+    for (int z = std::max(coord.z - 1, 0); z <= coord.z + 1; z++) {
+      for (int y = std::max(coord.y - 1, 0); y <= coord.y + 1; y++) {
+        for (int x = std::max(coord.x - 1, 0); x <= coord.x + 1; x++) {
+          const IndexRange *cell = cells.lookup_ptr(cell_key(int3(x, y, z)));
+          if (!cell) {
+            continue;
+          }
+          for (const int other : sorted_indices.as_span().slice(*cell)) {
+            if (other == i || r_dest_map[other] != OUT_OF_CONTEXT) {
+              continue;
+            }
+            if (math::distance_squared(positions[other], position) <= merge_dist_sq) {
+              r_dest_map[other] = i;
+              duplicates_num++;
+            }
+          }
+        }
+      }
+    }
+    if (duplicates_num != duplicates_num_prev) {
+      /* Prevent chains of doubles. */
+      r_dest_map[i] = i;
+    }
+  });
+  return duplicates_num;
+}
+
 std::optional<Mesh *> mesh_merge_by_distance_all(const Mesh &mesh,
                                                  const IndexMask &selection,
                                                  const float merge_distance)
 {
   Array<int> vert_dest_map(mesh.verts_num, OUT_OF_CONTEXT);
 
-  KDTree_3d *tree = BLI_kdtree_3d_new(selection.size());
-
   const Span<float3> positions = mesh.vert_positions();
-  selection.foreach_index([&](const int64_t i) { BLI_kdtree_3d_insert(tree, i, positions[i]); });
 
-  BLI_kdtree_3d_balance(tree);
-  const int vert_kill_len = BLI_kdtree_3d_calc_duplicates_fast(
-      tree, merge_distance, true, vert_dest_map.data());
-  BLI_kdtree_3d_free(tree);
+  int vert_kill_len;
+  if (const std::optional<int> grid_kill_len = calc_duplicates_grid(
+          positions, selection, merge_distance, vert_dest_map))
+  {
+    vert_kill_len = *grid_kill_len;
+  }
+  else {
+    KDTree_3d *tree = BLI_kdtree_3d_new(selection.size());
+    selection.foreach_index(
+        [&](const int64_t i) { BLI_kdtree_3d_insert(tree, i, positions[i]); });
+
+    BLI_kdtree_3d_balance(tree);
+    vert_kill_len = BLI_kdtree_3d_calc_duplicates_fast(
+        tree, merge_distance, true, vert_dest_map.data());
+    BLI_kdtree_3d_free(tree);
+  }
 
   if (vert_kill_len == 0) {
     return std::nullopt;
@@ -80,7 +80,8 @@ struct RealizePointCloudTask {
   const PointCloudRealizeInfo *pointcloud_info;
   /** Transformation that is applied to all positions. */
   float4x4 transform;
-  AttributeFallbacksArray attribute_fallbacks;
+  /** Shared between all tasks that don't have different instance attribute values. */
+  const AttributeFallbacksArray *attribute_fallbacks;
   /** Only used when the output contains an output attribute. */
   uint32_t id = 0;
 };
@@ -115,7 +116,8 @@ struct RealizeMeshTask {
   const MeshRealizeInfo *mesh_info;
   /** Transformation that is applied to all positions. */
   float4x4 transform;
-  AttributeFallbacksArray attribute_fallbacks;
+  /** Shared between all tasks that don't have different instance attribute values. */
+  const AttributeFallbacksArray *attribute_fallbacks;
   /** Only used when the output contains an output attribute. */
   uint32_t id = 0;
 };
@@ -172,7 +174,8 @@ struct RealizeCurveTask {
   const RealizeCurveInfo *curve_info;
   /** Transformation applied to the position of control points and handles. */
   float4x4 transform;
-  AttributeFallbacksArray attribute_fallbacks;
+  /** Shared between all tasks that don't have different instance attribute values. */
+  const AttributeFallbacksArray *attribute_fallbacks;
   /** Only used when the output contains an output attribute. */
   uint32_t id = 0;
 };
@@ -190,7 +193,8 @@ struct RealizeGreasePencilTask {
   int start_index;
   const GreasePencilRealizeInfo *grease_pencil_info;
   float4x4 transform;
-  AttributeFallbacksArray attribute_fallbacks;
+  /** Shared between all tasks that don't have different instance attribute values. */
+  const AttributeFallbacksArray *attribute_fallbacks;
 };
 
 struct RealizeEditDataTask {
@@ -255,7 +259,7 @@ struct AllGreasePencilsInfo {
 
 struct AllInstancesInfo {
   /** Stores an array of void pointer to attributes for each component. */
-  Vector<AttributeFallbacksArray> attribute_fallback;
+  Vector<const AttributeFallbacksArray *> attribute_fallback;
   /** Instance components to merge for output geometry. */
   Vector<bke::GeometryComponentPtr> instances_components_to_merge;
   /** Base transform for each instance component. */
@@ -312,31 +316,49 @@ struct GatherTasksInfo {
   GatherTasks r_tasks;
   /** Current offsets while gathering tasks. */
   GatherOffsets r_offsets;
+
+  /**
+   * Owns the attribute fallback arrays referenced by the tasks. A new array is only added when an
+   * instance actually overrides attribute values, so that all other tasks can share the array of
+   * their parent instead of storing a copy each. This keeps the memory usage of the gathered tasks
+   * low when realizing millions of instances.
+   */
+  Vector<std::unique_ptr<AttributeFallbacksArray>> attribute_fallbacks_storage;
 };
 
+static const AttributeFallbacksArray *add_attribute_fallbacks(GatherTasksInfo &gather_info,
+                                                              AttributeFallbacksArray fallbacks)
+{
+  gather_info.attribute_fallbacks_storage.append(
+      std::make_unique<AttributeFallbacksArray>(std::move(fallbacks)));
+  return gather_info.attribute_fallbacks_storage.last().get();
+}
+
 /**
  * Information about the parent instances in the current context.
  */
 struct InstanceContext {
   /** Ordered by #AllPointCloudsInfo.attributes. */
-  AttributeFallbacksArray pointclouds;
+  const AttributeFallbacksArray *pointclouds;
   /** Ordered by #AllMeshesInfo.attributes. */
-  AttributeFallbacksArray meshes;
+  const AttributeFallbacksArray *meshes;
   /** Ordered by #AllCurvesInfo.attributes. */
-  AttributeFallbacksArray curves;
+  const AttributeFallbacksArray *curves;
   /** Ordered by #AllGreasePencilsInfo.attributes. */
-  AttributeFallbacksArray grease_pencils;
+  const AttributeFallbacksArray *grease_pencils;
   /** Ordered by #AllInstancesInfo.attributes. */
-  AttributeFallbacksArray instances;
+  const AttributeFallbacksArray *instances;
   /** Id mixed from all parent instances. */
   uint32_t id = 0;
 
-  InstanceContext(const GatherTasksInfo &gather_info)
-      : pointclouds(gather_info.pointclouds.attributes.size()),
-        meshes(gather_info.meshes.attributes.size()),
-        curves(gather_info.curves.attributes.size()),
-        grease_pencils(gather_info.grease_pencils.attributes.size()),
-        instances(gather_info.instances_attriubutes.size())
+  InstanceContext(GatherTasksInfo &gather_info)
+      : pointclouds(
+            add_attribute_fallbacks(gather_info, gather_info.pointclouds.attributes.size())),
+        meshes(add_attribute_fallbacks(gather_info, gather_info.meshes.attributes.size())),
+        curves(add_attribute_fallbacks(gather_info, gather_info.curves.attributes.size())),
+        grease_pencils(
+            add_attribute_fallbacks(gather_info, gather_info.grease_pencils.attributes.size())),
+        instances(add_attribute_fallbacks(gather_info, gather_info.instances_attriubutes.size()))
   {
     // empty
   }
@@ -521,6 +543,26 @@ static Vector<std::pair<int, GSpan>> prepare_attribute_fallbacks(
   return attributes_to_override;
 }
 
+/**
+ * Get the attribute fallbacks for a single instance. When the instances don't override any of
+ * the attributes, the fallbacks of the parent context are shared instead of copied.
+ */
+static const AttributeFallbacksArray *get_instance_attribute_fallbacks(
+    GatherTasksInfo &gather_info,
+    const AttributeFallbacksArray *base_fallbacks,
+    const Span<std::pair<int, GSpan>> attributes_to_override,
+    const int instance_index)
+{
+  if (attributes_to_override.is_empty()) {
+    return base_fallbacks;
+  }
+  AttributeFallbacksArray fallbacks = *base_fallbacks;
+  for (const std::pair<int, GSpan> &pair : attributes_to_override) {
+    fallbacks.array[pair.first] = pair.second[instance_index];
+  }
+  return add_attribute_fallbacks(gather_info, std::move(fallbacks));
+}
+
 /**
  * Calls #fn for every geometry in the given #InstanceReference. Also passes on the transformation
  * that is applied to every instance.
@@ -582,21 +624,19 @@ static void gather_realize_tasks_for_instances(GatherTasksInfo &gather_info,
     const float4x4 new_base_transform = base_transform * transform;
 
     /* Update attribute fallbacks for the current instance. */
-    for (const std::pair<int, GSpan> &pair : pointcloud_attributes_to_override) {
-      instance_context.pointclouds.array[pair.first] = pair.second[i];
-    }
-    for (const std::pair<int, GSpan> &pair : mesh_attributes_to_override) {
-      instance_context.meshes.array[pair.first] = pair.second[i];
-    }
-    for (const std::pair<int, GSpan> &pair : curve_attributes_to_override) {
-      instance_context.curves.array[pair.first] = pair.second[i];
-    }
-    for (const std::pair<int, GSpan> &pair : grease_pencil_attributes_to_override) {
-      instance_context.grease_pencils.array[pair.first] = pair.second[i];
-    }
-    for (const std::pair<int, GSpan> &pair : instance_attributes_to_override) {
-      instance_context.instances.array[pair.first] = pair.second[i];
-    }
+    instance_context.pointclouds = get_instance_attribute_fallbacks(
+        gather_info, base_instance_context.pointclouds, pointcloud_attributes_to_override, i);
+    instance_context.meshes = get_instance_attribute_fallbacks(
+        gather_info, base_instance_context.meshes, mesh_attributes_to_override, i);
+    instance_context.curves = get_instance_attribute_fallbacks(
+        gather_info, base_instance_context.curves, curve_attributes_to_override, i);
+    instance_context.grease_pencils = get_instance_attribute_fallbacks(
+        gather_info,
+        base_instance_context.grease_pencils,
+        grease_pencil_attributes_to_override,
+        i);
+    instance_context.instances = get_instance_attribute_fallbacks(
+        gather_info, base_instance_context.instances, instance_attributes_to_override, i);
 
     uint32_t local_instance_id = 0;
     if (gather_info.create_id_attribute_on_any_component) {
@@ -928,7 +968,7 @@ static void execute_instances_tasks(
     const Span<bke::GeometryComponentPtr> src_components,
     Span<blender::float4x4> src_base_transforms,
     OrderedAttributes all_instances_attributes,
-    Span<blender::geometry::AttributeFallbacksArray> attribute_fallback,
+    Span<const blender::geometry::AttributeFallbacksArray *> attribute_fallback,
     bke::GeometrySet &r_realized_geometry)
 {
   BLI_assert(src_components.size() == src_base_transforms.size() &&
@@ -966,7 +1006,7 @@ static void execute_instances_tasks(
         *src_components[component_index]);
     const bke::Instances &src_instances = *src_component.get();
     const blender::float4x4 &src_base_transform = src_base_transforms[component_index];
-    const Span<const void *> attribute_fallback_array = attribute_fallback[component_index].array;
+    const Span<const void *> attribute_fallback_array = attribute_fallback[component_index]->array;
     const Span<bke::InstanceReference> src_references = src_instances.references();
     Array<int> handle_map(src_references.size());
 
@@ -1145,7 +1185,7 @@ static void execute_realize_pointcloud_task(
 
   copy_generic_attributes_to_result(
       pointcloud_info.attributes,
-      task.attribute_fallbacks,
+      *task.attribute_fallbacks,
       ordered_attributes,
       [&](const bke::AttrDomain domain) {
         BLI_assert(domain == bke::AttrDomain::Point);
@@ -1462,7 +1502,7 @@ static void execute_realize_mesh_task(const RealizeInstancesOptions &options,
 
   copy_generic_attributes_to_result(
       mesh_info.attributes,
-      task.attribute_fallbacks,
+      *task.attribute_fallbacks,
       ordered_attributes,
       [&](const bke::AttrDomain domain) {
         switch (domain) {
@@ -1807,7 +1847,7 @@ static void execute_realize_curve_task(const RealizeInstancesOptions &options,
 
   copy_generic_attributes_to_result(
       curves_info.attributes,
-      task.attribute_fallbacks,
+      *task.attribute_fallbacks,
       ordered_attributes,
       [&](const bke::AttrDomain domain) {
         switch (domain) {
@@ -2069,7 +2109,7 @@ static void execute_realize_grease_pencil_task(
 
   copy_generic_attributes_to_result(
       grease_pencil_info.attributes,
-      task.attribute_fallbacks,
+      *task.attribute_fallbacks,
       ordered_attributes,
       [&](const bke::AttrDomain domain) {
         BLI_assert(domain == bke::AttrDomain::Layer);
@@ -2272,7 +2312,8 @@ bke::GeometrySet realize_instances(bke::GeometrySet geometry_set,
     gather_info.instances.instances_components_to_merge.append(
         (not_to_realize_set.get_component_for_write<bke::InstancesComponent>()).copy());
     gather_info.instances.instances_components_transforms.append(float4x4::identity());
-    gather_info.instances.attribute_fallback.append((gather_info.instances_attriubutes.size()));
+    gather_info.instances.attribute_fallback.append(
+        add_attribute_fallbacks(gather_info, gather_info.instances_attriubutes.size()));
   }
 
   const float4x4 transform = float4x4::identity();
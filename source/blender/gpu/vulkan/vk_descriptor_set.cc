@@ -129,12 +129,42 @@ VKDescriptorSetTracker::Binding &VKDescriptorSetTracker::ensure_location(
   return bindings_.last();
 }
 
+bool VKDescriptorSetTracker::bindings_match_active_descriptor_set() const
+{
+  if (bindings_.size() != active_bindings_.size()) {
+    return false;
+  }
+  for (const int index : bindings_.index_range()) {
+    if (!bindings_[index].is_same_descriptor(active_bindings_[index])) {
+      return false;
+    }
+  }
+  return true;
+}
+
 void VKDescriptorSetTracker::update(VKContext &context)
 {
   const VKShader &shader = *unwrap(context.shader);
   VkDescriptorSetLayout vk_descriptor_set_layout = shader.vk_descriptor_set_layout_get();
+
+  for (Binding &binding : bindings_) {
+    if (binding.is_image()) {
+      binding.vk_image_view = binding.texture->image_view_get(binding.arrayed).vk_handle();
+    }
+  }
+
+  /* Reuse the active descriptor set when it has been written with the same layout and
+   * bindings. */
+  const bool is_dirty = vk_descriptor_set_layout != active_vk_descriptor_set_layout ||
+                        !bindings_match_active_descriptor_set();
   active_vk_descriptor_set_layout = vk_descriptor_set_layout;
-  tracked_resource_for(context, true);
+  bool is_new_descriptor_set = false;
+  tracked_resource_for(context, is_dirty, &is_new_descriptor_set);
+  if (!is_new_descriptor_set) {
+    bindings_.clear();
+    return;
+  }
+
   std::unique_ptr<VKDescriptorSet> &descriptor_set = active_descriptor_set();
   VkDescriptorSet vk_descriptor_set = descriptor_set->vk_handle();
   BLI_assert(vk_descriptor_set != VK_NULL_HANDLE);
@@ -189,9 +219,7 @@ void VKDescriptorSetTracker::update(VKContext &context)
     /* TODO: Based on the actual usage we should use
      * VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL or VK_IMAGE_LAYOUT_GENERAL. */
     vk_descriptor_image_infos_.append(
-        {binding.vk_sampler,
-         binding.texture->image_view_get(binding.arrayed).vk_handle(),
-         VK_IMAGE_LAYOUT_GENERAL});
+        {binding.vk_sampler, binding.vk_image_view, VK_IMAGE_LAYOUT_GENERAL});
     vk_write_descriptor_sets_.append({VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
                                       nullptr,
                                       vk_descriptor_set,
@@ -211,6 +239,7 @@ void VKDescriptorSetTracker::update(VKContext &context)
                          0,
                          nullptr);
 
+  active_bindings_ = std::move(bindings_);
   bindings_.clear();
   vk_descriptor_image_infos_.clear();
   vk_descriptor_buffer_infos_.clear();
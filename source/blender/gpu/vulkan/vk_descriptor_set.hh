@@ -130,12 +130,22 @@ class VKDescriptorSetTracker : protected VKResourceTracker<VKDescriptorSet> {
     VKTexture *texture = nullptr;
     VkSampler vk_sampler = VK_NULL_HANDLE;
     VKImageViewArrayed arrayed = VKImageViewArrayed::DONT_CARE;
+    /** Image view of the texture, resolved when the descriptor set is updated. */
+    VkImageView vk_image_view = VK_NULL_HANDLE;
 
     Binding()
     {
       location.binding = 0;
     }
 
+    /** Does this binding write the same descriptor as `other`. */
+    bool is_same_descriptor(const Binding &other) const
+    {
+      return location == other.location && type == other.type && vk_buffer == other.vk_buffer &&
+             buffer_size == other.buffer_size && vk_buffer_view == other.vk_buffer_view &&
+             vk_sampler == other.vk_sampler && vk_image_view == other.vk_image_view;
+    }
+
     bool is_buffer() const
     {
       return ELEM(type, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER);
@@ -160,6 +170,12 @@ class VKDescriptorSetTracker : protected VKResourceTracker<VKDescriptorSet> {
  private:
   /** A list of bindings that needs to be updated. */
   Vector<Binding> bindings_;
+  /**
+   * Bindings written to the active descriptor set. Consecutive draws often use the same
+   * resources, in which case the active descriptor set is reused instead of allocating and
+   * writing a new one.
+   */
+  Vector<Binding> active_bindings_;
 
   VkDescriptorSetLayout active_vk_descriptor_set_layout = VK_NULL_HANDLE;
 
@@ -199,6 +215,7 @@ class VKDescriptorSetTracker : protected VKResourceTracker<VKDescriptorSet> {
 
  private:
   Binding &ensure_location(VKDescriptorSet::Location location);
+  bool bindings_match_active_descriptor_set() const;
 };
 
 }  // namespace blender::gpu
@@ -6,6 +6,13 @@
  * \ingroup gpu
  */
 
+#include "MEM_guardedalloc.h"
+
+#include "BKE_appdir.hh"
+
+#include "BLI_fileops.hh"
+#include "BLI_path_util.h"
+
 #include "vk_pipeline_pool.hh"
 #include "vk_backend.hh"
 #include "vk_memory.hh"
@@ -115,16 +122,131 @@ VKPipelinePool::VKPipelinePool()
   vk_push_constant_range_.offset = 0;
   vk_push_constant_range_.size = 0;
 }
-void VKPipelinePool::init()
+/* -------------------------------------------------------------------- */
+/** \name Pipeline cache persistence
+ *
+ * The contents of the pipeline caches are stored in the user cache folder when the device is
+ * freed and used as initial data on the next start, so pipelines compiled in a previous session
+ * don't have to be compiled by the driver again.
+ * \{ */
+
+static std::string pipeline_cache_filepath_get(const char *name)
+{
+  char cache_dir[FILE_MAX];
+  if (!BKE_appdir_folder_caches(cache_dir, sizeof(cache_dir))) {
+    return "";
+  }
+
+  std::string filepath = std::string(cache_dir) + "vk-pipeline-cache" + SEP_STR + name + ".bin";
+  BLI_file_ensure_parent_dir_exists(filepath.c_str());
+  return filepath;
+}
+
+/**
+ * Check that cached data has been created by the same device and driver. Drivers are required to
+ * reject incompatible data, but not all of them do so reliably.
+ */
+static bool pipeline_cache_data_is_compatible(const VKDevice &device, Span<uint8_t> data)
+{
+  if (data.size() < sizeof(VkPipelineCacheHeaderVersionOne)) {
+    return false;
+  }
+  VkPipelineCacheHeaderVersionOne header;
+  memcpy(&header, data.data(), sizeof(header));
+
+  const VkPhysicalDeviceProperties &properties = device.physical_device_properties_get();
+  return header.headerVersion == VK_PIPELINE_CACHE_HEADER_VERSION_ONE &&
+         header.vendorID == properties.vendorID && header.deviceID == properties.deviceID &&
+         memcmp(header.pipelineCacheUUID, properties.pipelineCacheUUID, VK_UUID_SIZE) == 0;
+}
+
+static VkPipelineCache pipeline_cache_create(const VKDevice &device, const char *name)
 {
   VK_ALLOCATION_CALLBACKS;
-  VKDevice &device = VKBackend::get().device;
   VkPipelineCacheCreateInfo create_info = {};
   create_info.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
-  vkCreatePipelineCache(
-      device.vk_handle(), &create_info, vk_allocation_callbacks, &vk_pipeline_cache_static_);
-  vkCreatePipelineCache(
-      device.vk_handle(), &create_info, vk_allocation_callbacks, &vk_pipeline_cache_non_static_);
+
+  const std::string filepath = pipeline_cache_filepath_get(name);
+  size_t data_size = 0;
+  void *data = nullptr;
+  if (!filepath.empty()) {
+    data = BLI_file_read_binary_as_mem(filepath.c_str(), 0, &data_size);
+  }
+  if (data && pipeline_cache_data_is_compatible(
+                  device, Span<uint8_t>(static_cast<const uint8_t *>(data), data_size)))
+  {
+    create_info.initialDataSize = data_size;
+    create_info.pInitialData = data;
+  }
+
+  VkPipelineCache vk_pipeline_cache = VK_NULL_HANDLE;
+  if (vkCreatePipelineCache(
+          device.vk_handle(), &create_info, vk_allocation_callbacks, &vk_pipeline_cache) !=
+          VK_SUCCESS &&
+      create_info.pInitialData)
+  {
+    /* Retry without the cached data, it could have been corrupted. */
+    create_info.initialDataSize = 0;
+    create_info.pInitialData = nullptr;
+    vkCreatePipelineCache(
+        device.vk_handle(), &create_info, vk_allocation_callbacks, &vk_pipeline_cache);
+  }
+
+  if (data) {
+    MEM_freeN(data);
+  }
+  return vk_pipeline_cache;
+}
+
+static void pipeline_cache_write(const VKDevice &device,
+                                 VkPipelineCache vk_pipeline_cache,
+                                 const char *name)
+{
+  const std::string filepath = pipeline_cache_filepath_get(name);
+  if (filepath.empty()) {
+    return;
+  }
+
+  size_t data_size = 0;
+  if (vkGetPipelineCacheData(device.vk_handle(), vk_pipeline_cache, &data_size, nullptr) !=
+          VK_SUCCESS ||
+      data_size == 0)
+  {
+    return;
+  }
+  Vector<uint8_t> data(data_size);
+  if (vkGetPipelineCacheData(device.vk_handle(), vk_pipeline_cache, &data_size, data.data()) !=
+      VK_SUCCESS)
+  {
+    return;
+  }
+
+  /* Write to a temporary file first and move it into place when complete, so that a failed or
+   * interrupted write never leaves a truncated cache behind for the next session. */
+  const std::string filepath_tmp = filepath + ".tmp";
+  bool write_ok = false;
+  {
+    fstream file(filepath_tmp, std::ios::binary | std::ios::out | std::ios::trunc);
+    if (file.is_open()) {
+      file.write(reinterpret_cast<const char *>(data.data()), data_size);
+      write_ok = file.good() && size_t(file.tellp()) == data_size;
+      file.close();
+      write_ok = write_ok && !file.fail();
+    }
+  }
+
+  if (!write_ok || BLI_rename_overwrite(filepath_tmp.c_str(), filepath.c_str()) != 0) {
+    BLI_delete(filepath_tmp.c_str(), false, false);
+  }
+}
+
+/** \} */
+
+void VKPipelinePool::init()
+{
+  VKDevice &device = VKBackend::get().device;
+  vk_pipeline_cache_static_ = pipeline_cache_create(device, "static");
+  vk_pipeline_cache_non_static_ = pipeline_cache_create(device, "non_static");
 }
 
 VkSpecializationInfo *VKPipelinePool::specialization_info_update(
@@ -635,6 +757,9 @@ void VKPipelinePool::free_data()
   }
   compute_pipelines_.clear();
 
+  pipeline_cache_write(device, vk_pipeline_cache_static_, "static");
+  pipeline_cache_write(device, vk_pipeline_cache_non_static_, "non_static");
+
   vkDestroyPipelineCache(device.vk_handle(), vk_pipeline_cache_static_, vk_allocation_callbacks);
   vkDestroyPipelineCache(
       device.vk_handle(), vk_pipeline_cache_non_static_, vk_allocation_callbacks);
@@ -150,15 +150,25 @@ template<typename Resource> class VKResourceTracker : NonCopyable {
    * The resource given back is owned by this resource tracker. And
    * the resource should not be stored outside this class as it might
    * be destroyed when the next submission is detected.
+   *
+   * When `r_is_new` is given it is set to true when a new resource has been created.
    */
-  std::unique_ptr<Resource> &tracked_resource_for(VKContext &context, const bool is_dirty)
+  std::unique_ptr<Resource> &tracked_resource_for(VKContext &context,
+                                                  const bool is_dirty,
+                                                  bool *r_is_new = nullptr)
   {
+    bool is_new = false;
     if (submission_tracker_.is_changed(context)) {
       free_tracked_resources();
       tracked_resources_.append(create_resource(context));
+      is_new = true;
     }
     else if (is_dirty || tracked_resources_.is_empty()) {
       tracked_resources_.append(create_resource(context));
+      is_new = true;
+    }
+    if (r_is_new) {
+      *r_is_new = is_new;
     }
     return active_resource();
   }
@@ -40,6 +40,8 @@
 
 #pragma once
 
+#include <atomic>
+
 #include "../gpu/GPU_texture.hh"
 
 #include "BLI_utildefines.h"
@@ -323,6 +325,13 @@ void IMB_anim_index_rebuild(IndexBuildContext *context,
                             bool *stop,
                             bool *do_update,
                             float *progress);
+/**
+ * Same as above, for indices which are built while other threads request stopping with \a stop
+ * and read the \a progress.
+ */
+void IMB_anim_index_rebuild(IndexBuildContext *context,
+                            const std::atomic<bool> *stop,
+                            std::atomic<float> *progress);
 
 /**
  * Finish rebuilding proxies/time-codes and free temporary contexts used.
@@ -39,6 +39,12 @@ void IMB_moviecache_set_priority_callback(MovieCache *cache,
                                           MovieCacheGetPriorityDataFP getprioritydatafp,
                                           MovieCacheGetItemPriorityFP getitempriorityfp,
                                           MovieCachePriorityDeleterFP prioritydeleterfp);
+/**
+ * Reserve a fraction of the cache limiter maximum for this cache. While the cache uses less
+ * memory than that, its buffers are only freed after buffers of caches which are above their
+ * share or have none, so consumers sharing the limiter don't evict each other's hot frames.
+ */
+void IMB_moviecache_set_memory_share(MovieCache *cache, float share);
 
 void IMB_moviecache_put(MovieCache *cache, void *userkey, ImBuf *ibuf);
 bool IMB_moviecache_put_if_possible(MovieCache *cache, void *userkey, ImBuf *ibuf);
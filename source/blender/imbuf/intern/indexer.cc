@@ -6,6 +6,7 @@
  * \ingroup imbuf
  */
 
+#include <atomic>
 #include <cstdlib>
 
 #include "MEM_guardedalloc.h"
@@ -1011,10 +1012,13 @@ static void index_rebuild_ffmpeg_proc_decoded_frame(FFmpegIndexBuilderContext *c
   context->frameno_gapless++;
 }
 
+/* Templated on the types of the stop flag and the progress, so that they can be atomic when they
+ * are accessed by other threads. */
+template<typename StopT, typename ProgressT>
 static int index_rebuild_ffmpeg(FFmpegIndexBuilderContext *context,
-                                const bool *stop,
+                                const StopT *stop,
                                 bool *do_update,
-                                float *progress)
+                                ProgressT *progress)
 {
   AVFrame *in_frame = av_frame_alloc();
   AVPacket *next_packet = av_packet_alloc();
@@ -1313,6 +1317,22 @@ void IMB_anim_index_rebuild(IndexBuildContext *context,
   UNUSED_VARS(context, stop, do_update, progress);
 }
 
+void IMB_anim_index_rebuild(IndexBuildContext *context,
+                            const std::atomic<bool> *stop,
+                            std::atomic<float> *progress)
+{
+#ifdef WITH_FFMPEG
+  if (context != nullptr) {
+    if (indexer_need_to_build_proxy((FFmpegIndexBuilderContext *)context)) {
+      /* Nobody else reads the update flag here, the progress is polled instead. */
+      bool do_update = false;
+      index_rebuild_ffmpeg((FFmpegIndexBuilderContext *)context, stop, &do_update, progress);
+    }
+  }
+#endif
+  UNUSED_VARS(context, stop, progress);
+}
+
 void IMB_anim_index_rebuild_finish(IndexBuildContext *context, const bool stop)
 {
 #ifdef WITH_FFMPEG
@@ -8,6 +8,8 @@
 
 #undef DEBUG_MESSAGES
 
+#include <algorithm>
+#include <climits>
 #include <cstdlib> /* for qsort */
 #include <memory.h>
 #include <mutex>
@@ -64,7 +66,12 @@ struct MovieCache {
   void *last_userkey;
 
   int totseg, *points, proxy, render_flags; /* for visual statistics optimization */
-  int pad;
+
+  /* Fraction of the cache limiter maximum reserved for this cache, see
+   * #IMB_moviecache_set_memory_share. Zero when nothing is reserved. */
+  float memory_share;
+  /* Memory used by the buffers owned by this cache, protected by #limitor_lock. */
+  size_t memory_in_use;
 };
 
 struct MovieCacheKey {
@@ -77,6 +84,8 @@ struct MovieCacheItem {
   ImBuf *ibuf;
   MEM_CacheLimiterHandleC *c_handle;
   void *priority_data;
+  /* Size of #ibuf accounted in #MovieCache::memory_in_use. */
+  size_t memory_size;
   /* Indicates that #ibuf is null, because there was an error during load. */
   bool added_empty;
 };
@@ -115,6 +124,9 @@ static void moviecache_valfree(void *val)
   if (item->c_handle) {
     limitor_lock.lock();
     MEM_CacheLimiter_unmanage(item->c_handle);
+    if (item->ibuf) {
+      cache->memory_in_use -= item->memory_size;
+    }
     limitor_lock.unlock();
   }
 
@@ -179,6 +191,7 @@ static void moviecache_destructor(void *p)
 
     item->ibuf = nullptr;
     item->c_handle = nullptr;
+    cache->memory_in_use -= item->memory_size;
 
     /* force cached segments to be updated */
     MEM_SAFE_FREE(cache->points);
@@ -206,6 +219,20 @@ static size_t get_item_size(void *p)
   return size;
 }
 
+/* Priority offset of items which are not covered by the memory share of their cache. Priorities
+ * are negative distances (frames or queue positions), so this keeps them below every item which
+ * is covered, while preserving the order among themselves. */
+#define MOVIECACHE_UNRESERVED_PRIORITY_OFFSET (INT_MIN / 2)
+
+static bool is_within_memory_share(const MovieCache *cache)
+{
+  if (cache->memory_share <= 0.0f) {
+    return false;
+  }
+  const size_t max = MEM_CacheLimiter_get_maximum();
+  return max != 0 && cache->memory_in_use <= size_t(double(max) * cache->memory_share);
+}
+
 static int get_item_priority(void *item_v, int default_priority)
 {
   MovieCacheItem *item = (MovieCacheItem *)item_v;
@@ -219,12 +246,17 @@ static int get_item_priority(void *item_v, int default_priority)
           item,
           default_priority);
 
-    return default_priority;
+    priority = default_priority;
   }
+  else {
+    priority = cache->getitempriorityfp(cache->last_userkey, item->priority_data);
 
-  priority = cache->getitempriorityfp(cache->last_userkey, item->priority_data);
+    PRINT("%s: cache '%s' item %p priority %d\n", __func__, cache->name, item, priority);
+  }
 
-  PRINT("%s: cache '%s' item %p priority %d\n", __func__, cache->name, item, priority);
+  if (!is_within_memory_share(cache)) {
+    priority = std::max(priority, -(INT_MAX / 2)) + MOVIECACHE_UNRESERVED_PRIORITY_OFFSET;
+  }
 
   return priority;
 }
@@ -306,6 +338,11 @@ void IMB_moviecache_set_priority_callback(MovieCache *cache,
   cache->prioritydeleterfp = prioritydeleterfp;
 }
 
+void IMB_moviecache_set_memory_share(MovieCache *cache, float share)
+{
+  cache->memory_share = share;
+}
+
 static void do_moviecache_put(MovieCache *cache, void *userkey, ImBuf *ibuf, bool need_lock)
 {
   MovieCacheKey *key;
@@ -332,6 +369,7 @@ static void do_moviecache_put(MovieCache *cache, void *userkey, ImBuf *ibuf, boo
   item->cache_owner = cache;
   item->c_handle = nullptr;
   item->priority_data = nullptr;
+  item->memory_size = (ibuf == nullptr) ? 0 : get_size_in_memory(ibuf);
   item->added_empty = ibuf == nullptr;
 
   if (cache->getprioritydatafp) {
@@ -349,6 +387,7 @@ static void do_moviecache_put(MovieCache *cache, void *userkey, ImBuf *ibuf, boo
   }
 
   item->c_handle = MEM_CacheLimiter_insert(limitor, item);
+  cache->memory_in_use += item->memory_size;
 
   MEM_CacheLimiter_ref(item->c_handle);
   MEM_CacheLimiter_enforce_limits(limitor);
@@ -66,7 +66,7 @@ static void get_uvs(const CDStreamConfig &config,
   }
 
   const OffsetIndices faces = config.mesh->faces();
-  int *corner_verts = config.corner_verts;
+  const int *corner_verts = config.corner_verts;
 
   if (!config.pack_uvs) {
     int count = 0;
@@ -94,7 +94,7 @@ static void get_uvs(const CDStreamConfig &config,
 
     for (const int i : faces.index_range()) {
       const IndexRange face = faces[i];
-      int *face_verts = corner_verts + face.start() + face.size();
+      const int *face_verts = corner_verts + face.start() + face.size();
       const float2 *loopuv = mloopuv_array + face.start() + face.size();
 
       for (int j = 0; j < face.size(); j++) {
@@ -36,10 +36,11 @@ struct UVSample {
 };
 
 struct CDStreamConfig {
-  int *corner_verts;
+  /* Only read, the mesh reader takes write access itself when it changes the topology. */
+  const int *corner_verts;
   int totloop;
 
-  int *face_offsets;
+  const int *face_offsets;
   int faces_num;
 
   float3 *positions;
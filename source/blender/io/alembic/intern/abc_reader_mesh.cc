@@ -122,6 +122,9 @@ struct AbcMeshData {
   AbcUvScope uv_scope;
   V2fArraySamplePtr uvs;
   UInt32ArraySamplePtr uvs_indices;
+
+  /* The faces of the mesh already match the sample, only per-corner data has to be read. */
+  bool use_existing_topology = false;
 };
 
 static void read_mverts_interp(float3 *vert_positions,
@@ -180,8 +183,6 @@ void read_mverts(Mesh &mesh, const P3fArraySamplePtr positions, const N3fArraySa
 
 static void read_mpolys(CDStreamConfig &config, const AbcMeshData &mesh_data)
 {
-  int *face_offsets = config.face_offsets;
-  int *corner_verts = config.corner_verts;
   float2 *mloopuvs = config.mloopuv;
 
   const Int32ArraySamplePtr &face_indices = mesh_data.face_indices;
@@ -193,7 +194,14 @@ static void read_mpolys(CDStreamConfig &config, const AbcMeshData &mesh_data)
 
   const bool do_uvs = (mloopuvs && uvs && uvs_indices);
   const bool do_uvs_per_loop = do_uvs && mesh_data.uv_scope == ABC_UV_SCOPE_LOOP;
+  const bool do_topology = !mesh_data.use_existing_topology;
   BLI_assert(!do_uvs || mesh_data.uv_scope != ABC_UV_SCOPE_NONE);
+  if (!do_topology && !do_uvs) {
+    return;
+  }
+  /* Only take write access when the topology is rebuilt, to keep it shared otherwise. */
+  int *face_offsets = do_topology ? config.mesh->face_offsets_for_write().data() : nullptr;
+  int *corner_verts = do_topology ? config.mesh->corner_verts_for_write().data() : nullptr;
   uint loop_index = 0;
   uint rev_loop_index = 0;
   uint uv_index = 0;
@@ -202,7 +210,9 @@ static void read_mpolys(CDStreamConfig &config, const AbcMeshData &mesh_data)
   for (int i = 0; i < face_counts->size(); i++) {
     const int face_size = (*face_counts)[i];
 
-    face_offsets[i] = loop_index;
+    if (do_topology) {
+      face_offsets[i] = loop_index;
+    }
 
     /* Polygons are always assumed to be smooth-shaded. If the Alembic mesh should be flat-shaded,
      * this is encoded in custom loop normals. See #71246. */
@@ -213,12 +223,14 @@ static void read_mpolys(CDStreamConfig &config, const AbcMeshData &mesh_data)
     uint last_vertex_index = 0;
     for (int f = 0; f < face_size; f++, loop_index++, rev_loop_index--) {
       const int vert = (*face_indices)[loop_index];
-      corner_verts[rev_loop_index] = vert;
+      if (do_topology) {
+        corner_verts[rev_loop_index] = vert;
 
-      if (f > 0 && vert == last_vertex_index) {
-        /* This face is invalid, as it has consecutive loops from the same vertex. This is caused
-         * by invalid geometry in the Alembic file, such as in #76514. */
-        seen_invalid_geometry = true;
+        if (f > 0 && vert == last_vertex_index) {
+          /* This face is invalid, as it has consecutive loops from the same vertex. This is
+           * caused by invalid geometry in the Alembic file, such as in #76514. */
+          seen_invalid_geometry = true;
+        }
       }
       last_vertex_index = vert;
 
@@ -236,6 +248,10 @@ static void read_mpolys(CDStreamConfig &config, const AbcMeshData &mesh_data)
     }
   }
 
+  if (!do_topology) {
+    return;
+  }
+
   bke::mesh_calc_edges(*config.mesh, false, false);
   if (seen_invalid_geometry) {
     if (config.modifier_error_message) {
@@ -436,7 +452,8 @@ static void read_mesh_sample(const std::string &iobject_full_name,
                              ImportSettings *settings,
                              const IPolyMeshSchema &schema,
                              const ISampleSelector &selector,
-                             CDStreamConfig &config)
+                             CDStreamConfig &config,
+                             const bool use_existing_topology)
 {
   const IPolyMeshSchema::Sample sample = schema.getValue(selector);
 
@@ -444,6 +461,7 @@ static void read_mesh_sample(const std::string &iobject_full_name,
   abc_mesh_data.face_counts = sample.getFaceCounts();
   abc_mesh_data.face_indices = sample.getFaceIndices();
   abc_mesh_data.positions = sample.getPositions();
+  abc_mesh_data.use_existing_topology = use_existing_topology;
 
   const std::optional<SampleInterpolationSettings> interpolation_settings =
       get_sample_interpolation_settings(
@@ -491,8 +509,8 @@ static CDStreamConfig get_config(Mesh *mesh)
   CDStreamConfig config;
   config.mesh = mesh;
   config.positions = mesh->vert_positions_for_write().data();
-  config.corner_verts = mesh->corner_verts_for_write().data();
-  config.face_offsets = mesh->face_offsets_for_write().data();
+  config.corner_verts = mesh->corner_verts().data();
+  config.face_offsets = mesh->face_offsets().data();
   config.totvert = mesh->verts_num;
   config.totloop = mesh->corners_num;
   config.faces_num = mesh->faces_num;
@@ -776,12 +794,24 @@ Mesh *AbcMeshReader::read_mesh(Mesh *existing_mesh,
     }
   }
 
+  /* With constant topology the faces, corners and edges of the existing mesh are kept as they
+   * are (and stay shared with the original mesh), only the varying data is updated.
+   * #topology_changed doesn't compare the connectivity of single-sample topology, so at least
+   * make sure the sizes match. */
+  const bool use_existing_topology = new_mesh == nullptr &&
+                                     face_counts->size() == existing_mesh->faces_num &&
+                                     face_indices->size() == existing_mesh->corners_num;
   Mesh *mesh_to_export = new_mesh ? new_mesh : existing_mesh;
   CDStreamConfig config = get_config(mesh_to_export);
   config.time = sample_sel.getRequestedTime();
   config.modifier_error_message = r_err_str;
 
-  read_mesh_sample(m_iobject.getFullName(), &settings, m_schema, sample_sel, config);
+  read_mesh_sample(m_iobject.getFullName(),
+                   &settings,
+                   m_schema,
+                   sample_sel,
+                   config,
+                   use_existing_topology);
 
   if (new_mesh) {
     /* Here we assume that the number of materials doesn't change, i.e. that
@@ -24,6 +24,8 @@
 
 #include "DEG_depsgraph.hh"
 
+#include "BLI_span.hh"
+
 #include <map>
 #include <set>
 #include <string>
@@ -254,9 +256,12 @@ class AbstractHierarchyIterator {
   void export_graph_clear();
 
   void visit_object(Object *object, Object *export_parent, bool weak_export);
-  void visit_dupli_object(DupliObject *dupli_object,
-                          Object *duplicator,
-                          const DupliParentFinder &dupli_parent_finder);
+  void visit_dupli_objects(Span<DupliObject *> dupli_objects,
+                           Object *duplicator,
+                           const DupliParentFinder &dupli_parent_finder);
+  void init_dupli_context(HierarchyContext *context,
+                          DupliObject *dupli_object,
+                          Object *duplicator) const;
 
   void context_update_for_graph_index(HierarchyContext *context,
                                       const ExportGraph::key_type &graph_index) const;
@@ -25,7 +25,10 @@ Mesh *convert_ply_to_mesh(PlyData &data, const PLYImportParams &params)
   Mesh *mesh = BKE_mesh_new_nomain(
       data.vertices.size(), data.edges.size(), data.face_sizes.size(), data.face_vertices.size());
 
+  /* Every array of the PLY data is released as soon as it has been copied into the mesh, so that
+   * the peak memory usage stays close to the size of one copy of the data. */
   mesh->vert_positions_for_write().copy_from(data.vertices);
+  data.vertices.clear_and_shrink();
 
   bke::MutableAttributeAccessor attributes = mesh->attributes_for_write();
 
@@ -44,6 +47,7 @@ Mesh *convert_ply_to_mesh(PlyData &data, const PLYImportParams &params)
       }
       edges[i] = {v1, v2};
     }
+    data.edges.clear_and_shrink();
   }
 
   /* Add faces to the mesh. */
@@ -66,6 +70,7 @@ Mesh *convert_ply_to_mesh(PlyData &data, const PLYImportParams &params)
       }
       offset += size;
     }
+    data.face_sizes.clear_and_shrink();
   }
 
   /* Vertex colors */
@@ -85,6 +90,7 @@ Mesh *convert_ply_to_mesh(PlyData &data, const PLYImportParams &params)
       }
     }
     colors.finish();
+    data.vertex_colors.clear_and_shrink();
     BKE_id_attributes_active_color_set(&mesh->id, "Col");
     BKE_id_attributes_default_color_set(&mesh->id, "Col");
   }
@@ -97,13 +103,15 @@ Mesh *convert_ply_to_mesh(PlyData &data, const PLYImportParams &params)
       uv_map.span[i] = data.uv_coordinates[data.face_vertices[i]];
     }
     uv_map.finish();
+    data.uv_coordinates.clear_and_shrink();
   }
+  data.face_vertices.clear_and_shrink();
 
   /* If we have custom vertex normals, set them (note: important to do this
    * after initializing the loops). */
   bool set_custom_normals_for_verts = false;
   if (!data.vertex_normals.is_empty()) {
-    if (!data.face_sizes.is_empty()) {
+    if (mesh->faces_num != 0) {
       /* For a non-point-cloud mesh, set custom normals. */
       /* Deferred because this relies on valid mesh data. */
       set_custom_normals_for_verts = true;
@@ -114,6 +122,7 @@ Mesh *convert_ply_to_mesh(PlyData &data, const PLYImportParams &params)
           "normal",
           bke::AttrDomain::Point,
           bke::AttributeInitVArray(VArray<float3>::ForSpan(data.vertex_normals)));
+      data.vertex_normals.clear_and_shrink();
     }
   }
   else {
@@ -123,10 +132,11 @@ Mesh *convert_ply_to_mesh(PlyData &data, const PLYImportParams &params)
 
   /* Custom attributes: add them after anything above. */
   if (params.import_attributes && !data.vertex_custom_attr.is_empty()) {
-    for (const PlyCustomAttribute &attr : data.vertex_custom_attr) {
+    for (PlyCustomAttribute &attr : data.vertex_custom_attr) {
       attributes.add<float>(attr.name,
                             bke::AttrDomain::Point,
                             bke::AttributeInitVArray(VArray<float>::ForSpan(attr.data)));
+      attr.data.clear_and_shrink();
     }
   }
 
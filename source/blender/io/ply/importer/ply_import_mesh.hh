@@ -17,6 +17,7 @@ namespace blender::io::ply {
 
 /**
  * Converts the #PlyData data-structure to a mesh.
+ * The data arrays are released while they are moved into the mesh.
  * \return A new mesh that can be used inside blender.
  */
 Mesh *convert_ply_to_mesh(PlyData &data, const PLYImportParams &params);
@@ -25,6 +25,7 @@
 #include "BLI_math_rotation.h"
 #include "BLI_path_util.h"
 #include "BLI_string.h"
+#include "BLI_task.hh"
 #include "BLI_timeit.hh"
 
 #include "BLT_translation.hh"
@@ -337,6 +338,21 @@ static void import_startjob(void *customdata, wmJobWorkerStatus *worker_status)
     }
   }
 
+  /* Read geometry of all prims concurrently into standalone data-blocks,
+   * only moving it into the objects below needs access to Main. */
+  threading::parallel_for(archive->readers().index_range(), 16, [&](const IndexRange range) {
+    for (USDPrimReader *reader : archive->readers().as_span().slice(range)) {
+      if (reader) {
+        reader->read_geometry_data(0.0);
+      }
+    }
+  });
+
+  if (G.is_break) {
+    data->was_canceled = true;
+    return;
+  }
+
   /* Setup parenthood and read actual object data. */
   i = 0;
   for (USDPrimReader *reader : archive->readers()) {
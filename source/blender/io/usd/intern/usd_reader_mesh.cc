@@ -16,6 +16,7 @@
 #include "BKE_attribute.hh"
 #include "BKE_customdata.hh"
 #include "BKE_geometry_set.hh"
+#include "BKE_lib_id.hh"
 #include "BKE_main.hh"
 #include "BKE_material.h"
 #include "BKE_mesh.hh"
@@ -159,10 +160,19 @@ USDMeshReader::USDMeshReader(const pxr::UsdPrim &prim,
       mesh_prim_(prim),
       is_left_handed_(false),
       is_time_varying_(false),
-      is_initial_load_(false)
+      is_initial_load_(false),
+      prefetched_mesh_(nullptr),
+      is_prefetched_(false)
 {
 }
 
+USDMeshReader::~USDMeshReader()
+{
+  if (prefetched_mesh_) {
+    BKE_id_free(nullptr, prefetched_mesh_);
+  }
+}
+
 static std::optional<bke::AttrDomain> convert_usd_varying_to_blender(const pxr::TfToken usd_domain)
 {
   static const blender::Map<pxr::TfToken, bke::AttrDomain> domain_map = []() {
@@ -196,7 +206,7 @@ void USDMeshReader::create_object(Main *bmain, const double /*motionSampleTime*/
   object_->data = mesh;
 }
 
-void USDMeshReader::read_object_data(Main *bmain, const double motionSampleTime)
+void USDMeshReader::read_geometry_data(const double motionSampleTime)
 {
   Mesh *mesh = (Mesh *)object_->data;
 
@@ -208,8 +218,23 @@ void USDMeshReader::read_object_data(Main *bmain, const double motionSampleTime)
 
   is_initial_load_ = false;
   if (read_mesh != mesh) {
-    BKE_mesh_nomain_to_mesh(read_mesh, mesh, object_);
+    prefetched_mesh_ = read_mesh;
+  }
+  is_prefetched_ = true;
+}
+
+void USDMeshReader::read_object_data(Main *bmain, const double motionSampleTime)
+{
+  Mesh *mesh = (Mesh *)object_->data;
+
+  if (!is_prefetched_) {
+    this->read_geometry_data(motionSampleTime);
+  }
+  if (prefetched_mesh_) {
+    BKE_mesh_nomain_to_mesh(prefetched_mesh_, mesh, object_);
+    prefetched_mesh_ = nullptr;
   }
+  is_prefetched_ = false;
 
   readFaceSetsSample(bmain, mesh, motionSampleTime);
 
@@ -6,6 +6,7 @@
 #include "usd_attribute_utils.hh"
 
 #include "BKE_geometry_set.hh"
+#include "BKE_lib_id.hh"
 #include "BKE_object.hh"
 #include "BKE_pointcloud.hh"
 
@@ -26,6 +27,13 @@ USDPointsReader::USDPointsReader(const pxr::UsdPrim &prim,
 {
 }
 
+USDPointsReader::~USDPointsReader()
+{
+  if (prefetched_point_cloud_) {
+    BKE_id_free(nullptr, prefetched_point_cloud_);
+  }
+}
+
 bool USDPointsReader::valid() const
 {
   return bool(points_prim_);
@@ -38,7 +46,7 @@ void USDPointsReader::create_object(Main *bmain, double /*motionSampleTime*/)
   object_->data = point_cloud;
 }
 
-void USDPointsReader::read_object_data(Main *bmain, double motionSampleTime)
+void USDPointsReader::read_geometry_data(double motionSampleTime)
 {
   if (!points_prim_) {
     /* Invalid prim, so we pass. */
@@ -59,8 +67,28 @@ void USDPointsReader::read_object_data(Main *bmain, double motionSampleTime)
       geometry_set.get_component_for_write<bke::PointCloudComponent>().release();
 
   if (read_point_cloud != point_cloud) {
-    BKE_pointcloud_nomain_to_pointcloud(read_point_cloud, point_cloud);
+    prefetched_point_cloud_ = read_point_cloud;
+  }
+  is_prefetched_ = true;
+}
+
+void USDPointsReader::read_object_data(Main *bmain, double motionSampleTime)
+{
+  if (!points_prim_) {
+    /* Invalid prim, so we pass. */
+    return;
+  }
+
+  PointCloud *point_cloud = static_cast<PointCloud *>(object_->data);
+
+  if (!is_prefetched_) {
+    this->read_geometry_data(motionSampleTime);
+  }
+  if (prefetched_point_cloud_) {
+    BKE_pointcloud_nomain_to_pointcloud(prefetched_point_cloud_, point_cloud);
+    prefetched_point_cloud_ = nullptr;
   }
+  is_prefetched_ = false;
 
   if (is_animated()) {
     /* If the point cloud has animated positions or attributes, we add the cache
@@ -20,16 +20,24 @@ class USDPointsReader : public USDGeomReader {
  private:
   pxr::UsdGeomPoints points_prim_;
 
+  /* Result of #read_geometry_data, null when the data was read into the object data directly. */
+  PointCloud *prefetched_point_cloud_ = nullptr;
+  bool is_prefetched_ = false;
+
  public:
   USDPointsReader(const pxr::UsdPrim &prim,
                   const USDImportParams &import_params,
                   const ImportSettings &settings);
+  ~USDPointsReader() override;
 
   bool valid() const override;
 
   /* Initial object creation. */
   void create_object(Main *bmain, double motionSampleTime) override;
 
+  /* Initial point cloud data read, without Main access. */
+  void read_geometry_data(double motionSampleTime) override;
+
   /* Initial point cloud data update. */
   void read_object_data(Main *bmain, double motionSampleTime) override;
 
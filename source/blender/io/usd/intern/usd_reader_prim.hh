@@ -108,6 +108,11 @@ class USDPrimReader {
   virtual bool valid() const;
 
   virtual void create_object(Main *bmain, double motionSampleTime) = 0;
+  /**
+   * Read the prim data which doesn't require access to Main into standalone data-blocks, for
+   * #read_object_data to use. Called after #create_object, concurrently for all readers.
+   */
+  virtual void read_geometry_data(double /*motionSampleTime*/){};
   virtual void read_object_data(Main * /*bmain*/, double /*motionSampleTime*/){};
 
   Object *object() const;
@@ -19,6 +19,7 @@
 #include "BLI_assert.h"
 #include "BLI_color.hh"
 #include "BLI_math_vector_types.hh"
+#include "BLI_task.hh"
 
 #include "BKE_attribute.hh"
 #include "BKE_customdata.hh"
@@ -647,10 +648,13 @@ static void get_vert_creases(const Mesh *mesh, USDMeshData &usd_mesh_data)
 
 void USDGenericMeshWriter::get_geometry_data(const Mesh *mesh, USDMeshData &usd_mesh_data)
 {
-  get_positions(mesh, usd_mesh_data);
-  get_loops_polys(mesh, usd_mesh_data);
-  get_edge_creases(mesh, usd_mesh_data);
-  get_vert_creases(mesh, usd_mesh_data);
+  /* Each step fills separate arrays of the export data, so they can run concurrently. */
+  threading::parallel_invoke(
+      mesh->corners_num > 1024,
+      [&]() { get_positions(mesh, usd_mesh_data); },
+      [&]() { get_loops_polys(mesh, usd_mesh_data); },
+      [&]() { get_edge_creases(mesh, usd_mesh_data); },
+      [&]() { get_vert_creases(mesh, usd_mesh_data); });
 }
 
 void USDGenericMeshWriter::assign_materials(const HierarchyContext &context,
@@ -743,9 +747,11 @@ void USDGenericMeshWriter::write_normals(const Mesh *mesh, pxr::UsdGeomMesh &usd
     case bke::MeshNormalDomain::Face: {
       const OffsetIndices faces = mesh->faces();
       const Span<float3> face_normals = mesh->face_normals();
-      for (const int i : faces.index_range()) {
-        dst_normals.slice(faces[i]).fill(face_normals[i]);
-      }
+      threading::parallel_for(faces.index_range(), 1024, [&](const IndexRange range) {
+        for (const int i : range) {
+          dst_normals.slice(faces[i]).fill(face_normals[i]);
+        }
+      });
       break;
     }
     case bke::MeshNormalDomain::Corner: {
@@ -8,6 +8,7 @@
 
 #include <cstdio>
 #include <memory>
+#include <mutex>
 #include <system_error>
 
 #include "BKE_context.hh"
@@ -159,7 +160,7 @@ static void write_mesh_objects(const Span<std::unique_ptr<OBJMesh>> exportable_a
 {
   /* Parallelization is over meshes/objects, which means
    * we have to have the output text buffer for each object,
-   * and write them all into the file at the end. */
+   * and write them into the file in the object order. */
   size_t count = exportable_as_mesh.size();
   Array<FormatHandler> buffers(count);
 
@@ -202,6 +203,14 @@ static void write_mesh_objects(const Span<std::unique_ptr<OBJMesh>> exportable_a
     offsets.normal_offset += obj.get_normal_coords().size();
   }
 
+  /* Objects are written into the file as soon as they and all objects before them are formatted,
+   * so file writing overlaps with formatting of the remaining objects and buffers are released
+   * early. */
+  FILE *f = obj_writer.get_outfile();
+  Array<bool> formatted(count, false);
+  size_t next_to_write = 0;
+  std::mutex write_mutex;
+
   /* Parallel over meshes: main result writing. */
   threading::parallel_for(IndexRange(count), 1, [&](IndexRange range) {
     for (const int i : range) {
@@ -240,14 +249,16 @@ static void write_mesh_objects(const Span<std::unique_ptr<OBJMesh>> exportable_a
       /* Nothing will need this object's data after this point, release
        * various arrays here. */
       obj.clear();
+
+      std::scoped_lock lock(write_mutex);
+      formatted[i] = true;
+      while (next_to_write < count && formatted[next_to_write]) {
+        buffers[next_to_write].write_to_file(f);
+        next_to_write++;
+      }
     }
   });
-
-  /* Write all the object text buffers into the output file. */
-  FILE *f = obj_writer.get_outfile();
-  for (auto &b : buffers) {
-    b.write_to_file(f);
-  }
+  BLI_assert(next_to_write == count);
 }
 
 /**
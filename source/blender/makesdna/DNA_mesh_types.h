@@ -18,6 +18,7 @@
 
 #  include <optional>
 
+#  include "BLI_index_mask_fwd.hh"
 #  include "BLI_math_vector_types.hh"
 #  include "BLI_memory_counter_fwd.hh"
 
@@ -322,6 +323,14 @@ typedef struct Mesh {
    * Cached map from each vertex to the faces using it.
    */
   blender::GroupedSpan<int> vert_to_face_map() const;
+  /**
+   * Cached map from each vertex to the edges using it.
+   */
+  blender::GroupedSpan<int> vert_to_edge_map() const;
+  /**
+   * Cached map from each edge to the faces using it.
+   */
+  blender::GroupedSpan<int> edge_to_face_map() const;
 
   /**
    * Cached information about loose edges, calculated lazily when necessary.
@@ -400,6 +409,12 @@ typedef struct Mesh {
 
   /** Call after changing vertex positions to tag lazily calculated caches for recomputation. */
   void tag_positions_changed();
+  /**
+   * Like #tag_positions_changed, but only the given vertices have moved. Face and vertex normals
+   * that are already cached are updated for the affected elements only, instead of recalculating
+   * them for the whole mesh.
+   */
+  void tag_positions_changed_partial(const blender::IndexMask &changed_verts);
   /** Call after moving every mesh vertex by the same translation. */
   void tag_positions_changed_uniformly();
   /** Like #tag_positions_changed but doesn't tag normals; they must be updated separately. */
@@ -761,7 +761,10 @@ typedef struct UserDef_Experimental {
   char use_animation_baklava;
   char use_docking;
   char enable_new_cpu_compositor;
-  char _pad[1];
+  char use_autosave_journal;
+  char use_background_save;
+  char use_evict_invisible_evaluated_data;
+  char _pad[6];
   /** `makesdna` does not allow empty structs. */
 } UserDef_Experimental;
 
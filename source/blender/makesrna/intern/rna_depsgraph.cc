@@ -272,6 +272,36 @@ static void rna_Depsgraph_debug_stats_gnuplot(Depsgraph *depsgraph,
   fclose(f);
 }
 
+static void rna_Depsgraph_debug_trace_begin(Depsgraph *depsgraph, ReportList *reports)
+{
+  if (DEG_is_evaluating(depsgraph)) {
+    BKE_report(reports, RPT_ERROR, "Cannot start tracing during evaluation");
+    return;
+  }
+  DEG_debug_trace_begin(depsgraph);
+}
+
+static void rna_Depsgraph_debug_trace_end(Depsgraph *depsgraph,
+                                          ReportList *reports,
+                                          const char *filepath)
+{
+  if (DEG_is_evaluating(depsgraph)) {
+    BKE_report(reports, RPT_ERROR, "Cannot stop tracing during evaluation");
+    return;
+  }
+  if (!DEG_debug_trace_is_active(depsgraph)) {
+    BKE_report(reports, RPT_ERROR, "Tracing was not started");
+    return;
+  }
+  FILE *f = fopen(filepath, "w");
+  if (f == nullptr) {
+    BKE_reportf(reports, RPT_ERROR, "Cannot open file \"%s\" for writing", filepath);
+    return;
+  }
+  DEG_debug_trace_end(depsgraph, f);
+  fclose(f);
+}
+
 static void rna_Depsgraph_debug_tag_update(Depsgraph *depsgraph)
 {
   DEG_graph_tag_relations_update(depsgraph);
@@ -716,6 +746,20 @@ static void rna_def_depsgraph(BlenderRNA *brna)
                                   "File name where gnuplot script will save the result");
   RNA_def_parameter_flags(parm, PropertyFlag(0), PARM_REQUIRED);
 
+  func = RNA_def_function(srna, "debug_trace_begin", "rna_Depsgraph_debug_trace_begin");
+  RNA_def_function_ui_description(
+      func, "Start recording the evaluation of every operation, until debug_trace_end is called");
+  RNA_def_function_flag(func, FUNC_USE_REPORTS);
+
+  func = RNA_def_function(srna, "debug_trace_end", "rna_Depsgraph_debug_trace_end");
+  RNA_def_function_ui_description(func,
+                                  "Stop recording and write the evaluations recorded since "
+                                  "debug_trace_begin in the Chrome trace event format");
+  RNA_def_function_flag(func, FUNC_USE_REPORTS);
+  parm = RNA_def_string_file_path(
+      func, "filepath", nullptr, FILE_MAX, "File Name", "Output path for the JSON trace file");
+  RNA_def_parameter_flags(parm, PropertyFlag(0), PARM_REQUIRED);
+
   func = RNA_def_function(srna, "debug_tag_update", "rna_Depsgraph_debug_tag_update");
 
   func = RNA_def_function(srna, "debug_stats", "rna_Depsgraph_debug_stats");
@@ -7451,6 +7451,27 @@ static void rna_def_userdef_experimental(BlenderRNA *brna)
   RNA_def_property_boolean_sdna(prop, nullptr, "enable_new_cpu_compositor", 1);
   RNA_def_property_ui_text(prop, "CPU Compositor", "Enable the new CPU compositor");
 
+  prop = RNA_def_property(srna, "use_autosave_journal", PROP_BOOLEAN, PROP_NONE);
+  RNA_def_property_boolean_sdna(prop, nullptr, "use_autosave_journal", 1);
+  RNA_def_property_ui_text(prop,
+                           "Incremental Auto Save",
+                           "Auto save into a journal that only stores the data changed since the "
+                           "previous auto save. Journals are restored when recovering auto saves");
+
+  prop = RNA_def_property(srna, "use_background_save", PROP_BOOLEAN, PROP_NONE);
+  RNA_def_property_boolean_sdna(prop, nullptr, "use_background_save", 1);
+  RNA_def_property_ui_text(prop,
+                           "Background Save",
+                           "Write blend-files to disk in the background when saving, the data is "
+                           "only collected on the main thread (uses more memory while saving)");
+
+  prop = RNA_def_property(srna, "use_evict_invisible_evaluated_data", PROP_BOOLEAN, PROP_NONE);
+  RNA_def_property_boolean_sdna(prop, nullptr, "use_evict_invisible_evaluated_data", 1);
+  RNA_def_property_ui_text(prop,
+                           "Free Hidden Evaluated Geometry",
+                           "Free the evaluated geometry of objects which stayed hidden in the "
+                           "viewport for a while, it is evaluated again once the object is shown");
+
   prop = RNA_def_property(srna, "use_all_linked_data_direct", PROP_BOOLEAN, PROP_NONE);
   RNA_def_property_ui_text(
       prop,
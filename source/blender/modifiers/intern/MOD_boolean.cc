@@ -576,6 +576,15 @@ static Mesh *modify_mesh(ModifierData *md, const ModifierEvalContext *ctx, Mesh
          * But for 2.90 better not try to be smart here. */
         BKE_mesh_wrapper_ensure_mdata(mesh_operand_ob);
 
+        /* Like #get_quick_mesh: an operand without faces leaves the result unchanged
+         * (intersect isn't supported with collections in this solver), so skip the costly
+         * conversion to and from #BMesh. */
+        if (mesh_operand_ob->faces_num == 0 &&
+            (bmd->operation == eBooleanModifierOp_Difference || result->faces_num != 0))
+        {
+          continue;
+        }
+
         bool is_flip;
         BMesh *bm = BMD_mesh_bm_create(result, object, mesh_operand_ob, operand_ob, &is_flip);
 
@@ -11,6 +11,7 @@
 #include "BLI_math_base.hh"
 #include "BLI_math_matrix.h"
 #include "BLI_math_vector.h"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
 
 #include "BLT_translation.hh"
@@ -147,6 +148,9 @@ static void mesh_get_boundaries(Mesh *mesh, float *smooth_weights)
   MEM_freeN(boundaries);
 }
 
+/* Vertices handled by a single task in the smoothing iterations. */
+#define SMOOTH_PARALLEL_GRAIN_SIZE 2048
+
 /* -------------------------------------------------------------------- */
 /* Simple Weighted Smoothing
  *
@@ -163,6 +167,7 @@ static void smooth_iter__simple(CorrectiveSmoothModifierData *csmd,
 
   const int edges_num = mesh->edges_num;
   const blender::Span<blender::int2> edges = mesh->edges();
+  const blender::GroupedSpan<int> vert_to_edge_map = mesh->vert_to_edge_map();
 
   struct SmoothingData_Simple {
     float delta[3];
@@ -200,26 +205,32 @@ static void smooth_iter__simple(CorrectiveSmoothModifierData *csmd,
   /* Main Smoothing Loop */
 
   while (iterations--) {
-    for (i = 0; i < edges_num; i++) {
-      SmoothingData_Simple *sd_v1;
-      SmoothingData_Simple *sd_v2;
-      float edge_dir[3];
-
-      sub_v3_v3v3(edge_dir, vertexCos[edges[i][1]], vertexCos[edges[i][0]]);
-
-      sd_v1 = &smooth_data[edges[i][0]];
-      sd_v2 = &smooth_data[edges[i][1]];
-
-      add_v3_v3(sd_v1->delta, edge_dir);
-      sub_v3_v3(sd_v2->delta, edge_dir);
-    }
-
-    for (i = 0; i < vertexCos.size(); i++) {
-      SmoothingData_Simple *sd = &smooth_data[i];
-      madd_v3_v3fl(vertexCos[i], sd->delta, vertex_edge_count_div[i]);
-      /* zero for the next iteration (saves memset on entire array) */
-      memset(sd, 0, sizeof(*sd));
-    }
+    /* Gather the deltas per vertex (instead of scattering per edge) so vertices can be handled in
+     * parallel, all positions are only updated once every delta has been computed. */
+    blender::threading::parallel_for(
+        vertexCos.index_range(), SMOOTH_PARALLEL_GRAIN_SIZE, [&](const blender::IndexRange range) {
+          for (const int64_t vert : range) {
+            SmoothingData_Simple *sd = &smooth_data[vert];
+            zero_v3(sd->delta);
+            for (const int edge : vert_to_edge_map[vert]) {
+              float edge_dir[3];
+              sub_v3_v3v3(edge_dir, vertexCos[edges[edge][1]], vertexCos[edges[edge][0]]);
+              if (edges[edge][0] == vert) {
+                add_v3_v3(sd->delta, edge_dir);
+              }
+              else {
+                sub_v3_v3(sd->delta, edge_dir);
+              }
+            }
+          }
+        });
+
+    blender::threading::parallel_for(
+        vertexCos.index_range(), SMOOTH_PARALLEL_GRAIN_SIZE, [&](const blender::IndexRange range) {
+          for (const int64_t vert : range) {
+            madd_v3_v3fl(vertexCos[vert], smooth_data[vert].delta, vertex_edge_count_div[vert]);
+          }
+        });
   }
 
   MEM_freeN(vertex_edge_count_div);
@@ -241,6 +252,7 @@ static void smooth_iter__length_weight(CorrectiveSmoothModifierData *csmd,
    * and 2.0 rarely spikes, double the value for consistent behavior. */
   const float lambda = csmd->lambda * 2.0f;
   const blender::Span<blender::int2> edges = mesh->edges();
+  const blender::GroupedSpan<int> vert_to_edge_map = mesh->vert_to_edge_map();
   uint i;
 
   struct SmoothingData_Weighted {
@@ -262,61 +274,66 @@ static void smooth_iter__length_weight(CorrectiveSmoothModifierData *csmd,
   /* Main Smoothing Loop */
 
   while (iterations--) {
-    for (i = 0; i < edges_num; i++) {
-      SmoothingData_Weighted *sd_v1;
-      SmoothingData_Weighted *sd_v2;
-      float edge_dir[3];
-      float edge_dist;
-
-      sub_v3_v3v3(edge_dir, vertexCos[edges[i][1]], vertexCos[edges[i][0]]);
-      edge_dist = len_v3(edge_dir);
-
-      /* weight by distance */
-      mul_v3_fl(edge_dir, edge_dist);
-
-      sd_v1 = &smooth_data[edges[i][0]];
-      sd_v2 = &smooth_data[edges[i][1]];
-
-      add_v3_v3(sd_v1->delta, edge_dir);
-      sub_v3_v3(sd_v2->delta, edge_dir);
-
-      sd_v1->edge_length_sum += edge_dist;
-      sd_v2->edge_length_sum += edge_dist;
-    }
+    /* See #smooth_iter__simple for why deltas are gathered per vertex. */
+    blender::threading::parallel_for(
+        vertexCos.index_range(), SMOOTH_PARALLEL_GRAIN_SIZE, [&](const blender::IndexRange range) {
+          for (const int64_t vert : range) {
+            SmoothingData_Weighted *sd = &smooth_data[vert];
+            zero_v3(sd->delta);
+            sd->edge_length_sum = 0.0f;
+            for (const int edge : vert_to_edge_map[vert]) {
+              float edge_dir[3];
+              float edge_dist;
+
+              sub_v3_v3v3(edge_dir, vertexCos[edges[edge][1]], vertexCos[edges[edge][0]]);
+              edge_dist = len_v3(edge_dir);
+
+              /* weight by distance */
+              mul_v3_fl(edge_dir, edge_dist);
+
+              if (edges[edge][0] == vert) {
+                add_v3_v3(sd->delta, edge_dir);
+              }
+              else {
+                sub_v3_v3(sd->delta, edge_dir);
+              }
+              sd->edge_length_sum += edge_dist;
+            }
+          }
+        });
 
     if (smooth_weights == nullptr) {
       /* fast-path */
-      for (i = 0; i < vertexCos.size(); i++) {
-        SmoothingData_Weighted *sd = &smooth_data[i];
-        /* Divide by sum of all neighbor distances (weighted) and amount of neighbors,
-         * (mean average). */
-        const float div = sd->edge_length_sum * vertex_edge_count[i];
-        if (div > eps) {
-#if 0
-          /* first calculate the new location */
-          mul_v3_fl(sd->delta, 1.0f / div);
-          /* then interpolate */
-          madd_v3_v3fl(vertexCos[i], sd->delta, lambda);
-#else
-          /* do this in one step */
-          madd_v3_v3fl(vertexCos[i], sd->delta, lambda / div);
-#endif
-        }
-        /* zero for the next iteration (saves memset on entire array) */
-        memset(sd, 0, sizeof(*sd));
-      }
+      blender::threading::parallel_for(
+          vertexCos.index_range(),
+          SMOOTH_PARALLEL_GRAIN_SIZE,
+          [&](const blender::IndexRange range) {
+            for (const int64_t vert : range) {
+              const SmoothingData_Weighted *sd = &smooth_data[vert];
+              /* Divide by sum of all neighbor distances (weighted) and amount of neighbors,
+               * (mean average). */
+              const float div = sd->edge_length_sum * vertex_edge_count[vert];
+              if (div > eps) {
+                /* Calculate the new location and interpolate in one step. */
+                madd_v3_v3fl(vertexCos[vert], sd->delta, lambda / div);
+              }
+            }
+          });
     }
     else {
-      for (i = 0; i < vertexCos.size(); i++) {
-        SmoothingData_Weighted *sd = &smooth_data[i];
-        const float div = sd->edge_length_sum * vertex_edge_count[i];
-        if (div > eps) {
-          const float lambda_w = lambda * smooth_weights[i];
-          madd_v3_v3fl(vertexCos[i], sd->delta, lambda_w / div);
-        }
-
-        memset(sd, 0, sizeof(*sd));
-      }
+      blender::threading::parallel_for(
+          vertexCos.index_range(),
+          SMOOTH_PARALLEL_GRAIN_SIZE,
+          [&](const blender::IndexRange range) {
+            for (const int64_t vert : range) {
+              const SmoothingData_Weighted *sd = &smooth_data[vert];
+              const float div = sd->edge_length_sum * vertex_edge_count[vert];
+              if (div > eps) {
+                const float lambda_w = lambda * smooth_weights[vert];
+                madd_v3_v3fl(vertexCos[vert], sd->delta, lambda_w / div);
+              }
+            }
+          });
     }
   }
 
@@ -15,6 +15,7 @@
 #include "BLI_bitmap.h"
 #include "BLI_math_matrix.h"
 #include "BLI_math_vector.h"
+#include "BLI_task.hh"
 
 #include "BLT_translation.hh"
 
@@ -129,9 +130,7 @@ static void mix_normals(const float mix_factor,
                         blender::float3 *nos_new)
 {
   /* Mix with org normals... */
-  float *facs = nullptr, *wfac;
-  blender::float3 *no_new, *no_old;
-  int i;
+  float *facs = nullptr;
 
   if (dvert) {
     facs = static_cast<float *>(
@@ -145,34 +144,38 @@ static void mix_normals(const float mix_factor,
                                               facs);
   }
 
-  for (i = corner_verts.size(), no_new = nos_new, no_old = nos_old, wfac = facs; i--;
-       no_new++, no_old++, wfac++)
-  {
-    const float fac = facs ? *wfac * mix_factor : mix_factor;
-
-    switch (mix_mode) {
-      case MOD_NORMALEDIT_MIX_ADD:
-        add_v3_v3(*no_new, *no_old);
-        normalize_v3(*no_new);
-        break;
-      case MOD_NORMALEDIT_MIX_SUB:
-        sub_v3_v3(*no_new, *no_old);
-        normalize_v3(*no_new);
-        break;
-      case MOD_NORMALEDIT_MIX_MUL:
-        mul_v3_v3(*no_new, *no_old);
-        normalize_v3(*no_new);
-        break;
-      case MOD_NORMALEDIT_MIX_COPY:
-        break;
-    }
-
-    interp_v3_v3v3_slerp_safe(
-        *no_new,
-        *no_old,
-        *no_new,
-        (mix_limit < float(M_PI)) ? min_ff(fac, mix_limit / angle_v3v3(*no_new, *no_old)) : fac);
-  }
+  blender::threading::parallel_for(
+      corner_verts.index_range(), 4096, [&](const blender::IndexRange range) {
+        for (const int64_t i : range) {
+          blender::float3 &no_new = nos_new[i];
+          const blender::float3 &no_old = nos_old[i];
+          const float fac = facs ? facs[i] * mix_factor : mix_factor;
+
+          switch (mix_mode) {
+            case MOD_NORMALEDIT_MIX_ADD:
+              add_v3_v3(no_new, no_old);
+              normalize_v3(no_new);
+              break;
+            case MOD_NORMALEDIT_MIX_SUB:
+              sub_v3_v3(no_new, no_old);
+              normalize_v3(no_new);
+              break;
+            case MOD_NORMALEDIT_MIX_MUL:
+              mul_v3_v3(no_new, no_old);
+              normalize_v3(no_new);
+              break;
+            case MOD_NORMALEDIT_MIX_COPY:
+              break;
+          }
+
+          interp_v3_v3v3_slerp_safe(
+              no_new,
+              no_old,
+              no_new,
+              (mix_limit < float(M_PI)) ? min_ff(fac, mix_limit / angle_v3v3(no_new, no_old)) :
+                                          fac);
+        }
+      });
 
   MEM_SAFE_FREE(facs);
 }
@@ -8,6 +8,8 @@
 
 #include "BLI_listbase.h"
 #include "BLI_math_geom.h"
+#include "BLI_task.hh"
+#include "BLI_vector.hh"
 
 #include "MOD_lineart.h"
 
@@ -18,6 +20,9 @@
 
 #define LRT_OTHER_VERT(e, vt) ((vt) == (e)->v1 ? (e)->v2 : ((vt) == (e)->v2 ? (e)->v1 : nullptr))
 
+/* Chains handled by a single task in the per-chain passes that run in parallel. */
+#define LRT_CHAIN_PARALLEL_GRAIN_SIZE 64
+
 struct Object;
 
 /* Get a connected line, only for lines who has the exact given vert, or (in the case of
@@ -1032,6 +1037,24 @@ void MOD_lineart_chain_connect(LineartData *ld)
   }
 }
 
+/**
+ * Run \a fn on every chain of \a ld in parallel. Only usable for passes that modify each chain
+ * independently and don't allocate from the (non thread-safe) render memory pool.
+ */
+template<typename Fn> static void lineart_chain_foreach_parallel(LineartData *ld, const Fn &fn)
+{
+  blender::Vector<LineartEdgeChain *> chains;
+  LISTBASE_FOREACH (LineartEdgeChain *, ec, &ld->chains) {
+    chains.append(ec);
+  }
+  blender::threading::parallel_for(
+      chains.index_range(), LRT_CHAIN_PARALLEL_GRAIN_SIZE, [&](const blender::IndexRange range) {
+        for (LineartEdgeChain *ec : chains.as_span().slice(range)) {
+          fn(ec);
+        }
+      });
+}
+
 float MOD_lineart_chain_compute_length(LineartEdgeChain *ec)
 {
   LineartEdgeChainItem *eci;
@@ -1096,13 +1119,13 @@ LineartElementLinkNode *lineart_find_matching_eln_obj(ListBase *elns, Object *ob
 
 void MOD_lineart_finalize_chains(LineartData *ld)
 {
-  LISTBASE_FOREACH (LineartEdgeChain *, ec, &ld->chains) {
+  lineart_chain_foreach_parallel(ld, [&](LineartEdgeChain *ec) {
     if (ELEM(ec->type,
              MOD_LINEART_EDGE_FLAG_INTERSECTION,
              MOD_LINEART_EDGE_FLAG_PROJECTED_SHADOW,
              MOD_LINEART_EDGE_FLAG_LIGHT_CONTOUR))
     {
-      continue;
+      return;
     }
     LineartElementLinkNode *eln = lineart_find_matching_eln_obj(&ld->geom.vertex_buffer_pointers,
                                                                 ec->object_ref);
@@ -1114,12 +1137,13 @@ void MOD_lineart_finalize_chains(LineartData *ld)
         }
       }
     }
-  }
+  });
 }
 
 void MOD_lineart_smooth_chains(LineartData *ld, float tolerance)
 {
-  LISTBASE_FOREACH (LineartEdgeChain *, ec, &ld->chains) {
+  /* Chains are simplified independently of each other, and only ever lose items. */
+  lineart_chain_foreach_parallel(ld, [&](LineartEdgeChain *ec) {
     /* Go through the chain two times, once from each direction. */
     for (int times = 0; times < 2; times++) {
       for (LineartEdgeChainItem *eci = static_cast<LineartEdgeChainItem *>(ec->chain.first),
@@ -1186,7 +1210,7 @@ void MOD_lineart_smooth_chains(LineartData *ld, float tolerance)
       }
       BLI_listbase_reverse(&ec->chain);
     }
-  }
+  });
 }
 
 static LineartEdgeChainItem *lineart_chain_create_crossing_point(LineartData *ld,
@@ -1359,10 +1383,8 @@ void MOD_lineart_chain_split_angle(LineartData *ld, float angle_threshold_rad)
 
 void MOD_lineart_chain_offset_towards_camera(LineartData *ld, float dist, bool use_custom_camera)
 {
-  float dir[3];
   float cam[3];
   float view[3];
-  float view_clamp[3];
 
   if (use_custom_camera) {
     copy_v3fl_v3db(cam, ld->conf.camera_pos);
@@ -1372,27 +1394,29 @@ void MOD_lineart_chain_offset_towards_camera(LineartData *ld, float dist, bool u
   }
 
   if (ld->conf.cam_is_persp) {
-    LISTBASE_FOREACH (LineartEdgeChain *, ec, &ld->chains) {
+    lineart_chain_foreach_parallel(ld, [&](LineartEdgeChain *ec) {
       LISTBASE_FOREACH (LineartEdgeChainItem *, eci, &ec->chain) {
+        float dir[3];
         sub_v3_v3v3(dir, cam, eci->gpos);
         float orig_len = len_v3(dir);
         normalize_v3(dir);
         mul_v3_fl(dir, std::min<float>(dist, orig_len - ld->conf.near_clip));
         add_v3_v3(eci->gpos, dir);
       }
-    }
+    });
   }
   else {
     copy_v3fl_v3db(view, ld->conf.view_vector);
-    LISTBASE_FOREACH (LineartEdgeChain *, ec, &ld->chains) {
+    lineart_chain_foreach_parallel(ld, [&](LineartEdgeChain *ec) {
       LISTBASE_FOREACH (LineartEdgeChainItem *, eci, &ec->chain) {
+        float dir[3], view_clamp[3];
         sub_v3_v3v3(dir, cam, eci->gpos);
         float len_lim = dot_v3v3(view, dir) - ld->conf.near_clip;
         normalize_v3_v3(view_clamp, view);
         mul_v3_fl(view_clamp, std::min(dist, len_lim));
         add_v3_v3(eci->gpos, view_clamp);
       }
-    }
+    });
   }
 }
 
@@ -103,32 +103,30 @@ static void node_gather_link_searches(GatherLinkSearchOpParams &params)
 }
 
 static void build_vert_to_vert_by_edge_map(const Span<int2> edges,
-                                           const int verts_num,
+                                           const GroupedSpan<int> vert_to_edge,
                                            Array<int> &r_offsets,
                                            Array<int> &r_indices)
 {
-  bke::mesh::build_vert_to_edge_map(edges, verts_num, r_offsets, r_indices);
+  r_offsets = vert_to_edge.offsets.data();
+  r_indices.reinitialize(vert_to_edge.data.size());
   const OffsetIndices<int> offsets(r_offsets);
-  threading::parallel_for(IndexRange(verts_num), 2048, [&](const IndexRange range) {
+  threading::parallel_for(vert_to_edge.index_range(), 2048, [&](const IndexRange range) {
     for (const int vert : range) {
+      const Span<int> vert_edges = vert_to_edge[vert];
       MutableSpan<int> neighbors = r_indices.as_mutable_span().slice(offsets[vert]);
       for (const int i : neighbors.index_range()) {
-        neighbors[i] = bke::mesh::edge_other_vert(edges[neighbors[i]], vert);
+        neighbors[i] = bke::mesh::edge_other_vert(edges[vert_edges[i]], vert);
       }
     }
   });
 }
 
 static void build_edge_to_edge_by_vert_map(const Span<int2> edges,
-                                           const int verts_num,
+                                           const GroupedSpan<int> vert_to_edge,
                                            Array<int> &r_offsets,
                                            Array<int> &r_indices)
 {
-  Array<int> vert_to_edge_offset_data;
-  Array<int> vert_to_edge_indices;
-  const GroupedSpan<int> vert_to_edge = bke::mesh::build_vert_to_edge_map(
-      edges, verts_num, vert_to_edge_offset_data, vert_to_edge_indices);
-  const OffsetIndices<int> vert_to_edge_offsets(vert_to_edge_offset_data);
+  const OffsetIndices<int> vert_to_edge_offsets = vert_to_edge.offsets;
 
   r_offsets = Array<int>(edges.size() + 1, 0);
   threading::parallel_for(edges.index_range(), 1024, [&](const IndexRange range) {
@@ -160,15 +158,11 @@ static void build_edge_to_edge_by_vert_map(const Span<int2> edges,
 
 static void build_face_to_face_by_edge_map(const OffsetIndices<int> faces,
                                            const Span<int> corner_edges,
-                                           const int edges_num,
+                                           const GroupedSpan<int> edge_to_face_map,
                                            Array<int> &r_offsets,
                                            Array<int> &r_indices)
 {
-  Array<int> edge_to_face_offset_data;
-  Array<int> edge_to_face_indices;
-  const GroupedSpan<int> edge_to_face_map = bke::mesh::build_edge_to_face_map(
-      faces, corner_edges, edges_num, edge_to_face_offset_data, edge_to_face_indices);
-  const OffsetIndices<int> edge_to_face_offsets(edge_to_face_offset_data);
+  const OffsetIndices<int> edge_to_face_offsets = edge_to_face_map.offsets;
 
   r_offsets = Array<int>(faces.size() + 1, 0);
   threading::parallel_for(faces.index_range(), 4096, [&](const IndexRange range) {
@@ -208,14 +202,14 @@ static GroupedSpan<int> create_mesh_map(const Mesh &mesh,
 {
   switch (domain) {
     case AttrDomain::Point:
-      build_vert_to_vert_by_edge_map(mesh.edges(), mesh.verts_num, r_offsets, r_indices);
+      build_vert_to_vert_by_edge_map(mesh.edges(), mesh.vert_to_edge_map(), r_offsets, r_indices);
       break;
     case AttrDomain::Edge:
-      build_edge_to_edge_by_vert_map(mesh.edges(), mesh.verts_num, r_offsets, r_indices);
+      build_edge_to_edge_by_vert_map(mesh.edges(), mesh.vert_to_edge_map(), r_offsets, r_indices);
       break;
     case AttrDomain::Face:
       build_face_to_face_by_edge_map(
-          mesh.faces(), mesh.corner_edges(), mesh.edges_num, r_offsets, r_indices);
+          mesh.faces(), mesh.corner_edges(), mesh.edge_to_face_map(), r_offsets, r_indices);
       break;
     default:
       BLI_assert_unreachable();
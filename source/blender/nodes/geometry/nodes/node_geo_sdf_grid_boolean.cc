@@ -7,6 +7,8 @@
 #  include <openvdb/tools/Composite.h>
 #endif
 
+#include "BLI_task.hh"
+
 #include "BKE_volume_grid.hh"
 
 #include "GEO_volume_grid_resample.hh"
@@ -62,6 +64,35 @@ static void node_init(bNodeTree * /*tree*/, bNode *node)
 }
 
 #ifdef WITH_OPENVDB
+/**
+ * Combine all grids into the first one, merging independent pairs in parallel. This is only valid
+ * for associative and commutative operations (union and intersection of level sets). The
+ * operation may consume the second grid of each pair.
+ */
+template<typename CombineFn>
+static void combine_grids_pairwise(MutableSpan<openvdb::FloatGrid *> grids, const CombineFn &fn)
+{
+  const int64_t grids_num = grids.size();
+  for (int64_t stride = 1; stride < grids_num; stride *= 2) {
+    const int64_t pairs_num = (grids_num + stride - 1) / (2 * stride);
+    std::atomic<bool> failed = false;
+    threading::parallel_for(IndexRange(pairs_num), 1, [&](const IndexRange range) {
+      for (const int64_t pair : range) {
+        const int64_t i = pair * 2 * stride;
+        try {
+          fn(*grids[i], *grids[i + stride]);
+        }
+        catch (const openvdb::ValueError & /*ex*/) {
+          failed = true;
+        }
+      }
+    });
+    if (failed) {
+      throw openvdb::ValueError("Failed to combine grids");
+    }
+  }
+}
+
 static void get_float_grids(MutableSpan<SocketValueVariant> values,
                             Vector<bke::VolumeGrid<float>> &grids)
 {
@@ -102,31 +133,48 @@ static void node_geo_exec(GeoNodeExecParams params)
   openvdb::FloatGrid &result_grid = operands.first().grid_for_write(result_token);
   const openvdb::math::Transform &transform = result_grid.transform();
 
-  for (bke::VolumeGrid<float> &volume_grid : operands.as_mutable_span().drop_front(1)) {
-    bke::VolumeTreeAccessToken tree_token;
-    std::shared_ptr<openvdb::FloatGrid> resampled_storage;
-    openvdb::FloatGrid &grid = geometry::resample_sdf_grid_if_necessary(
-        volume_grid, tree_token, transform, resampled_storage);
-
-    try {
-      switch (operation) {
-        case Operation::Intersect:
-          openvdb::tools::csgIntersection(result_grid, grid);
-          break;
-        case Operation::Union:
-          openvdb::tools::csgUnion(result_grid, grid);
-          break;
-        case Operation::Difference:
-          openvdb::tools::csgDifference(result_grid, grid);
-          break;
-      }
+  /* Resampling the other operands to the transform of the first one is independent per grid. */
+  const int64_t grids_num = operands.size();
+  Array<bke::VolumeTreeAccessToken> tree_tokens(grids_num);
+  Array<std::shared_ptr<openvdb::FloatGrid>> resampled_storage(grids_num);
+  Array<openvdb::FloatGrid *> grids(grids_num);
+  grids[0] = &result_grid;
+  threading::parallel_for(IndexRange(1, grids_num - 1), 1, [&](const IndexRange range) {
+    for (const int64_t i : range) {
+      grids[i] = &geometry::resample_sdf_grid_if_necessary(
+          operands[i], tree_tokens[i], transform, resampled_storage[i]);
     }
-    catch (const openvdb::ValueError & /*ex*/) {
-      /* May happen if a grid is empty. */
-      params.set_default_remaining_outputs();
-      return;
+  });
+
+  try {
+    switch (operation) {
+      case Operation::Intersect:
+        combine_grids_pairwise(grids, [](openvdb::FloatGrid &a, openvdb::FloatGrid &b) {
+          openvdb::tools::csgIntersection(a, b);
+        });
+        break;
+      case Operation::Union:
+        combine_grids_pairwise(grids, [](openvdb::FloatGrid &a, openvdb::FloatGrid &b) {
+          openvdb::tools::csgUnion(a, b);
+        });
+        break;
+      case Operation::Difference:
+        /* Subtracting every operand in turn is the same as subtracting their union. */
+        if (grids_num > 1) {
+          combine_grids_pairwise(grids.as_mutable_span().drop_front(1),
+                                 [](openvdb::FloatGrid &a, openvdb::FloatGrid &b) {
+                                   openvdb::tools::csgUnion(a, b);
+                                 });
+          openvdb::tools::csgDifference(result_grid, *grids[1]);
+        }
+        break;
     }
   }
+  catch (const openvdb::ValueError & /*ex*/) {
+    /* May happen if a grid is empty. */
+    params.set_default_remaining_outputs();
+    return;
+  }
 
   params.set_output("Grid", std::move(operands.first()));
 #else
@@ -464,16 +464,20 @@ static const mf::MultiFunction *get_multi_function(const bNode &node)
     case SOCK_FLOAT: {
       if (clamp_factor) {
         static auto fn = mf::build::SI3_SO<float, float, float, float>(
-            "Clamp Mix Float", [](float t, const float a, const float b) {
+            "Clamp Mix Float",
+            [](float t, const float a, const float b) {
               return math::interpolate(a, b, std::clamp(t, 0.0f, 1.0f));
-            });
+            },
+            mf::build::exec_presets::AllSpanOrSingle());
         return &fn;
       }
       else {
         static auto fn = mf::build::SI3_SO<float, float, float, float>(
-            "Mix Float", [](const float t, const float a, const float b) {
+            "Mix Float",
+            [](const float t, const float a, const float b) {
               return math::interpolate(a, b, t);
-            });
+            },
+            mf::build::exec_presets::AllSpanOrSingle());
         return &fn;
       }
     }
@@ -481,33 +485,41 @@ static const mf::MultiFunction *get_multi_function(const bNode &node)
       if (clamp_factor) {
         if (uniform_factor) {
           static auto fn = mf::build::SI3_SO<float, float3, float3, float3>(
-              "Clamp Mix Vector", [](const float t, const float3 a, const float3 b) {
+              "Clamp Mix Vector",
+              [](const float t, const float3 a, const float3 b) {
                 return math::interpolate(a, b, std::clamp(t, 0.0f, 1.0f));
-              });
+              },
+              mf::build::exec_presets::AllSpanOrSingle());
           return &fn;
         }
         else {
           static auto fn = mf::build::SI3_SO<float3, float3, float3, float3>(
-              "Clamp Mix Vector Non Uniform", [](float3 t, const float3 a, const float3 b) {
+              "Clamp Mix Vector Non Uniform",
+              [](float3 t, const float3 a, const float3 b) {
                 t = math::clamp(t, 0.0f, 1.0f);
                 return a * (float3(1.0f) - t) + b * t;
-              });
+              },
+              mf::build::exec_presets::AllSpanOrSingle());
           return &fn;
         }
       }
       else {
         if (uniform_factor) {
           static auto fn = mf::build::SI3_SO<float, float3, float3, float3>(
-              "Mix Vector", [](const float t, const float3 a, const float3 b) {
+              "Mix Vector",
+              [](const float t, const float3 a, const float3 b) {
                 return math::interpolate(a, b, t);
-              });
+              },
+              mf::build::exec_presets::AllSpanOrSingle());
           return &fn;
         }
         else {
           static auto fn = mf::build::SI3_SO<float3, float3, float3, float3>(
-              "Mix Vector Non Uniform", [](const float3 t, const float3 a, const float3 b) {
+              "Mix Vector Non Uniform",
+              [](const float3 t, const float3 a, const float3 b) {
                 return a * (float3(1.0f) - t) + b * t;
-              });
+              },
+              mf::build::exec_presets::AllSpanOrSingle());
           return &fn;
         }
       }
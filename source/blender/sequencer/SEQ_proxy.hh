@@ -8,6 +8,8 @@
  * \ingroup sequencer
  */
 
+#include <atomic>
+
 struct Depsgraph;
 struct GSet;
 struct ListBase;
@@ -28,6 +30,17 @@ bool SEQ_proxy_rebuild_context(Main *bmain,
                                bool build_only_on_bad_performance);
 void SEQ_proxy_rebuild(SeqIndexBuildContext *context, wmJobWorkerStatus *worker_status);
 void SEQ_proxy_rebuild_finish(SeqIndexBuildContext *context, bool stop);
+/**
+ * Whether the context can be rebuilt concurrently with other contexts of the same queue.
+ */
+bool SEQ_proxy_rebuild_supports_threading(const SeqIndexBuildContext *context);
+/**
+ * Rebuild a context that #SEQ_proxy_rebuild_supports_threading, while other threads request
+ * stopping with \a stop and read the \a progress.
+ */
+void SEQ_proxy_rebuild_threaded(SeqIndexBuildContext *context,
+                                const std::atomic<bool> &stop,
+                                std::atomic<float> &progress);
 void SEQ_proxy_set(Sequence *seq, bool value);
 bool SEQ_can_use_proxy(const SeqRenderData *context, const Sequence *seq, int psize);
 int SEQ_rendersize_to_proxysize(int render_size);
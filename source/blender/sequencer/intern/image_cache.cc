@@ -6,6 +6,7 @@
  * \ingroup bke
  */
 
+#include <algorithm>
 #include <cstddef>
 #include <ctime>
 #include <memory.h>
@@ -22,7 +23,9 @@
 #include "BLI_fileops_types.h"
 #include "BLI_ghash.h"
 #include "BLI_mempool.h"
+#include "BLI_set.hh"
 #include "BLI_threads.h"
+#include "BLI_vector.hh"
 
 #include "BKE_main.hh"
 
@@ -333,7 +336,13 @@ static SeqCacheKey *seq_cache_choose_key(Scene *scene, SeqCacheKey *lkey, SeqCac
   return finalkey;
 }
 
-static void seq_cache_recycle_linked(Scene *scene, SeqCacheKey *base)
+/**
+ * Remove all entries linked to `base`. When `r_removed_keys` is given, the removed keys are added
+ * to it, so that callers holding other keys can detect they have been freed.
+ */
+static void seq_cache_recycle_linked(Scene *scene,
+                                     SeqCacheKey *base,
+                                     blender::Set<SeqCacheKey *> *r_removed_keys = nullptr)
 {
   SeqCache *cache = seq_cache_get_from_scene(scene);
   if (!cache) {
@@ -355,6 +364,9 @@ static void seq_cache_recycle_linked(Scene *scene, SeqCacheKey *base)
     }
 
     seq_cache_key_unlink(base);
+    if (r_removed_keys) {
+      r_removed_keys->add(base);
+    }
     BLI_ghash_remove(cache->hash, base, seq_cache_keyfree, seq_cache_valfree);
     BLI_assert(base != cache->last_key);
     base = prev;
@@ -374,28 +386,29 @@ static void seq_cache_recycle_linked(Scene *scene, SeqCacheKey *base)
     }
 
     seq_cache_key_unlink(base);
+    if (r_removed_keys) {
+      r_removed_keys->add(base);
+    }
     BLI_ghash_remove(cache->hash, base, seq_cache_keyfree, seq_cache_valfree);
     BLI_assert(base != cache->last_key);
     base = next;
   }
 }
 
-static SeqCacheKey *seq_cache_get_item_for_removal(Scene *scene)
+/**
+ * Get the keys that can be recycled (the last key of each permanent entries chain), sorted by
+ * timeline frame.
+ */
+static blender::Vector<SeqCacheKey *> seq_cache_get_items_for_removal(Scene *scene)
 {
   SeqCache *cache = seq_cache_get_from_scene(scene);
-  SeqCacheKey *finalkey = nullptr;
-  /* Leftmost key. */
-  SeqCacheKey *lkey = nullptr;
-  /* Rightmost key. */
-  SeqCacheKey *rkey = nullptr;
-  SeqCacheKey *key = nullptr;
+  blender::Vector<SeqCacheKey *> keys;
 
   GHashIterator gh_iter;
   BLI_ghashIterator_init(&gh_iter, cache->hash);
-  int total_count = 0;
 
   while (!BLI_ghashIterator_done(&gh_iter)) {
-    key = static_cast<SeqCacheKey *>(BLI_ghashIterator_getKey(&gh_iter));
+    SeqCacheKey *key = static_cast<SeqCacheKey *>(BLI_ghashIterator_getKey(&gh_iter));
     SeqCacheItem *item = static_cast<SeqCacheItem *>(BLI_ghashIterator_getValue(&gh_iter));
     BLI_ghashIterator_step(&gh_iter);
     BLI_assert(key->cache_owner == cache);
@@ -404,6 +417,7 @@ static SeqCacheKey *seq_cache_get_item_for_removal(Scene *scene)
     if (!item->ibuf) {
       seq_cache_recycle_linked(scene, key);
       /* Can not continue iterating after linked remove. */
+      keys.clear();
       BLI_ghashIterator_init(&gh_iter, cache->hash);
       continue;
     }
@@ -412,30 +426,13 @@ static SeqCacheKey *seq_cache_get_item_for_removal(Scene *scene)
       continue;
     }
 
-    total_count++;
-
-    if (lkey) {
-      if (key->timeline_frame < lkey->timeline_frame) {
-        lkey = key;
-      }
-    }
-    else {
-      lkey = key;
-    }
-    if (rkey) {
-      if (key->timeline_frame > rkey->timeline_frame) {
-        rkey = key;
-      }
-    }
-    else {
-      rkey = key;
-    }
+    keys.append(key);
   }
-  (void)total_count; /* Quiet set-but-unused warning (may be removed). */
 
-  finalkey = seq_cache_choose_key(scene, lkey, rkey);
-
-  return finalkey;
+  std::stable_sort(keys.begin(), keys.end(), [](const SeqCacheKey *a, const SeqCacheKey *b) {
+    return a->timeline_frame < b->timeline_frame;
+  });
+  return keys;
 }
 
 bool seq_cache_recycle_item(Scene *scene)
@@ -447,11 +444,44 @@ bool seq_cache_recycle_item(Scene *scene)
 
   seq_cache_lock(scene);
 
+  /* Candidates are collected once and consumed from both ends (leftmost and rightmost frames),
+   * instead of iterating over the whole cache for every recycled frame. Keys freed as part of
+   * another chain are skipped, and candidates are collected again once all are consumed. */
+  blender::Vector<SeqCacheKey *> candidates;
+  blender::Set<SeqCacheKey *> removed_keys;
+  int64_t left = 0;
+  int64_t right = -1;
+
   while (seq_cache_is_full()) {
-    SeqCacheKey *finalkey = seq_cache_get_item_for_removal(scene);
+    while (left <= right && removed_keys.contains(candidates[left])) {
+      left++;
+    }
+    while (left <= right && removed_keys.contains(candidates[right])) {
+      right--;
+    }
+    if (left > right) {
+      candidates = seq_cache_get_items_for_removal(scene);
+      removed_keys.clear();
+      left = 0;
+      right = candidates.size() - 1;
+      if (candidates.is_empty()) {
+        seq_cache_unlock(scene);
+        return false;
+      }
+    }
+
+    SeqCacheKey *lkey = candidates[left];
+    SeqCacheKey *rkey = candidates[right];
+    SeqCacheKey *finalkey = seq_cache_choose_key(scene, lkey, rkey);
 
     if (finalkey) {
-      seq_cache_recycle_linked(scene, finalkey);
+      if (finalkey == lkey) {
+        left++;
+      }
+      else {
+        right--;
+      }
+      seq_cache_recycle_linked(scene, finalkey, &removed_keys);
     }
     else {
       seq_cache_unlock(scene);
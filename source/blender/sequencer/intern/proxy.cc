@@ -573,6 +573,21 @@ void SEQ_proxy_rebuild(SeqIndexBuildContext *context, wmJobWorkerStatus *worker_
   }
 }
 
+bool SEQ_proxy_rebuild_supports_threading(const SeqIndexBuildContext *context)
+{
+  /* Movie indices are built with a decoder and encoders owned by the index context, proxies of
+   * other strip types are rendered through the shared render pipeline. */
+  return context->seq->type == SEQ_TYPE_MOVIE && context->index_context != nullptr;
+}
+
+void SEQ_proxy_rebuild_threaded(SeqIndexBuildContext *context,
+                                const std::atomic<bool> &stop,
+                                std::atomic<float> &progress)
+{
+  BLI_assert(SEQ_proxy_rebuild_supports_threading(context));
+  IMB_anim_index_rebuild(context->index_context, &stop, &progress);
+}
+
 void SEQ_proxy_rebuild_finish(SeqIndexBuildContext *context, bool stop)
 {
   if (context->index_context) {
@@ -8,12 +8,21 @@
  * \ingroup bke
  */
 
+#include <algorithm>
+#include <atomic>
+
 #include "MEM_guardedalloc.h"
 
+#include "BLI_array.hh"
+#include "BLI_threads.h"
+#include "BLI_time.h"
+#include "BLI_vector.hh"
+
 #include "DNA_scene_types.h"
 #include "DNA_sequence_types.h"
 
 #include "BKE_context.hh"
+#include "BKE_global.hh"
 
 #include "SEQ_proxy.hh"
 #include "SEQ_relations.hh"
@@ -31,21 +40,141 @@ static void proxy_freejob(void *pjv)
   MEM_freeN(pj);
 }
 
-/* Only this runs inside thread. */
-static void proxy_startjob(void *pjv, wmJobWorkerStatus *worker_status)
+/**
+ * Upper bound of movie strips indexed at the same time. Every one of them runs its own FFmpeg
+ * decoder and encoders, which are multi-threaded already.
+ */
+#define PROXY_MAX_CONCURRENT_MOVIES 4
+
+/** State of a movie strip, shared between the job thread and the thread building its index. */
+struct ProxyMovieStatus {
+  std::atomic<bool> stop = false;
+  std::atomic<float> progress = 0.0f;
+};
+
+struct ProxyMovieQueue {
+  blender::Span<SeqIndexBuildContext *> contexts;
+  blender::MutableSpan<ProxyMovieStatus> statuses;
+  std::atomic<int> next_index;
+  std::atomic<int> finished_num;
+};
+
+static void *proxy_movie_thread_func(void *data)
 {
-  ProxyJob *pj = static_cast<ProxyJob *>(pjv);
+  ProxyMovieQueue *queue = static_cast<ProxyMovieQueue *>(data);
 
-  LISTBASE_FOREACH (LinkData *, link, &pj->queue) {
+  for (int i = queue->next_index++; i < queue->contexts.size(); i = queue->next_index++) {
+    ProxyMovieStatus &status = queue->statuses[i];
+    if (!status.stop) {
+      SEQ_proxy_rebuild_threaded(queue->contexts[i], status.stop, status.progress);
+    }
+    status.progress = 1.0f;
+    queue->finished_num++;
+  }
+  return nullptr;
+}
+
+/**
+ * Build the indices of several movie strips at once. The job thread only keeps combining the
+ * progress of every clip and forwarding cancellation while the workers are busy.
+ *
+ * Encoding blocks for a long time, so the movies are built on dedicated threads rather than in
+ * the shared task scheduler, where they would starve other work of worker threads.
+ */
+static void proxy_rebuild_movies_parallel(blender::Span<SeqIndexBuildContext *> contexts,
+                                          const int threads_num,
+                                          wmJobWorkerStatus *worker_status)
+{
+  blender::Array<ProxyMovieStatus> statuses(contexts.size());
+
+  ProxyMovieQueue queue;
+  queue.contexts = contexts;
+  queue.statuses = statuses;
+  queue.next_index = 0;
+  queue.finished_num = 0;
+
+  ListBase threads;
+  BLI_threadpool_init(&threads, proxy_movie_thread_func, threads_num);
+  for (int i = 0; i < threads_num; i++) {
+    BLI_threadpool_insert(&threads, &queue);
+  }
+
+  while (queue.finished_num < contexts.size()) {
+    const bool stop = worker_status->stop || G.is_break;
+    float progress = 0.0f;
+    for (ProxyMovieStatus &status : statuses) {
+      if (stop) {
+        status.stop = true;
+      }
+      progress += status.progress;
+    }
+    worker_status->progress = progress / contexts.size();
+    worker_status->do_update = true;
+    BLI_time_sleep_ms(50);
+  }
+
+  BLI_threadpool_end(&threads);
+}
+
+/**
+ * Build the contexts queued after \a last_link, or the whole queue when it is null. Returns the
+ * last link that was handled.
+ */
+static LinkData *proxy_rebuild_queued(ProxyJob *pj,
+                                      LinkData *last_link,
+                                      wmJobWorkerStatus *worker_status)
+{
+  blender::Vector<SeqIndexBuildContext *> movie_contexts;
+  blender::Vector<SeqIndexBuildContext *> serial_contexts;
+  LinkData *link = last_link ? last_link->next : static_cast<LinkData *>(pj->queue.first);
+  for (; link; link = link->next) {
     SeqIndexBuildContext *context = static_cast<SeqIndexBuildContext *>(link->data);
+    if (SEQ_proxy_rebuild_supports_threading(context)) {
+      movie_contexts.append(context);
+    }
+    else {
+      serial_contexts.append(context);
+    }
+    last_link = link;
+  }
 
-    SEQ_proxy_rebuild(context, worker_status);
+  const int threads_num = std::min<int>(
+      {BLI_system_thread_count(), PROXY_MAX_CONCURRENT_MOVIES, int(movie_contexts.size())});
+  if (threads_num > 1) {
+    proxy_rebuild_movies_parallel(movie_contexts, threads_num, worker_status);
+  }
+  else {
+    serial_contexts.insert(0, movie_contexts.as_span());
+  }
 
+  for (SeqIndexBuildContext *context : serial_contexts) {
     if (worker_status->stop) {
-      pj->stop = true;
-      fprintf(stderr, "Canceling proxy rebuild on users request...\n");
       break;
     }
+    SEQ_proxy_rebuild(context, worker_status);
+  }
+
+  return last_link;
+}
+
+/* Only this runs inside thread. */
+static void proxy_startjob(void *pjv, wmJobWorkerStatus *worker_status)
+{
+  ProxyJob *pj = static_cast<ProxyJob *>(pjv);
+
+  /* Strips can be added to the queue while the job is running, build those as well. */
+  LinkData *last_link = nullptr;
+  while (!worker_status->stop) {
+    LinkData *next_link = last_link ? last_link->next : static_cast<LinkData *>(pj->queue.first);
+    if (next_link == nullptr) {
+      break;
+    }
+    last_link = proxy_rebuild_queued(pj, last_link, worker_status);
+  }
+
+  if (worker_status->stop) {
+    pj->stop = true;
+    fprintf(stderr, "Canceling proxy rebuild on users request...\n");
   }
 }
 
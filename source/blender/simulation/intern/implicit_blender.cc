@@ -17,9 +17,12 @@
 #  include "DNA_scene_types.h"
 #  include "DNA_texture_types.h"
 
+#  include "BLI_array.hh"
 #  include "BLI_math_geom.h"
 #  include "BLI_math_matrix.h"
 #  include "BLI_math_vector.h"
+#  include "BLI_offset_indices.hh"
+#  include "BLI_task.hh"
 #  include "BLI_utildefines.h"
 
 #  include "BKE_cloth.hh"
@@ -36,6 +39,9 @@
 #    define CLOTH_OPENMP_LIMIT 512
 #  endif
 
+/* Number of vertices per task for the multi-threaded long vector and matrix operations. */
+#  define CLOTH_PARALLEL_GRAIN_SIZE 1024
+
 // #define DEBUG_TIME
 
 #  ifdef DEBUG_TIME
@@ -201,11 +207,12 @@ DO_INLINE void add_lfvector_lfvector(float (*to)[3],
 DO_INLINE void add_lfvector_lfvectorS(
     float (*to)[3], float (*fLongVectorA)[3], float (*fLongVectorB)[3], float bS, uint verts)
 {
-  uint i = 0;
-
-  for (i = 0; i < verts; i++) {
-    VECADDS(to[i], fLongVectorA[i], fLongVectorB[i], bS);
-  }
+  blender::threading::parallel_for(
+      blender::IndexRange(verts), CLOTH_PARALLEL_GRAIN_SIZE, [&](const blender::IndexRange range) {
+        for (const int64_t i : range) {
+          VECADDS(to[i], fLongVectorA[i], fLongVectorB[i], bS);
+        }
+      });
 }
 /* `A = B * float + C * float` -> for big vector */
 DO_INLINE void add_lfvectorS_lfvectorS(float (*to)[3],
@@ -236,11 +243,12 @@ DO_INLINE void sub_lfvector_lfvector(float (*to)[3],
                                      float (*fLongVectorB)[3],
                                      uint verts)
 {
-  uint i = 0;
-
-  for (i = 0; i < verts; i++) {
-    sub_v3_v3v3(to[i], fLongVectorA[i], fLongVectorB[i]);
-  }
+  blender::threading::parallel_for(
+      blender::IndexRange(verts), CLOTH_PARALLEL_GRAIN_SIZE, [&](const blender::IndexRange range) {
+        for (const int64_t i : range) {
+          sub_v3_v3v3(to[i], fLongVectorA[i], fLongVectorB[i]);
+        }
+      });
 }
 ///////////////////////////
 // 3x3 matrix
@@ -613,6 +621,81 @@ DO_INLINE void mul_bfmatrix_lfvector(float (*to)[3], fmatrix3x3 *from, lfVector
   del_lfvector(temp);
 }
 
+/**
+ * Off-diagonal blocks of a sparse symmetric big matrix grouped by the vertex they contribute to,
+ * so that a matrix-vector product can be computed per vertex without write conflicts.
+ * Only depends on the sparsity pattern, so it can be reused while the pattern doesn't change.
+ */
+struct BigMatrixRowMap {
+  /** Blocks stored with their row as the vertex (multiplied as is). */
+  blender::Array<int> row_offsets;
+  blender::Array<int> row_blocks;
+  /** Blocks stored with their column as the vertex (multiplied transposed). */
+  blender::Array<int> col_offsets;
+  blender::Array<int> col_blocks;
+};
+
+static void build_vertex_block_map(const fmatrix3x3 *matrix,
+                                   const bool use_column,
+                                   blender::Array<int> &r_offsets,
+                                   blender::Array<int> &r_blocks)
+{
+  const uint vcount = matrix[0].vcount;
+  const uint blocks_end = vcount + matrix[0].scount;
+  r_offsets.reinitialize(vcount + 1);
+  r_offsets.fill(0);
+  for (uint i = vcount; i < blocks_end; i++) {
+    r_offsets[use_column ? matrix[i].c : matrix[i].r]++;
+  }
+  const blender::OffsetIndices<int> offsets =
+      blender::offset_indices::accumulate_counts_to_offsets(r_offsets);
+  blender::Array<int> fill_counts(vcount, 0);
+  r_blocks.reinitialize(offsets.total_size());
+  for (uint i = vcount; i < blocks_end; i++) {
+    const uint vert = use_column ? matrix[i].c : matrix[i].r;
+    r_blocks[offsets[vert][fill_counts[vert]++]] = int(i);
+  }
+}
+
+static void build_bfmatrix_row_map(const fmatrix3x3 *matrix, BigMatrixRowMap &r_map)
+{
+  build_vertex_block_map(matrix, false, r_map.row_offsets, r_map.row_blocks);
+  build_vertex_block_map(matrix, true, r_map.col_offsets, r_map.col_blocks);
+}
+
+/**
+ * Multi-threaded version of #mul_bfmatrix_lfvector using a precomputed #BigMatrixRowMap.
+ * Every vertex gathers its own diagonal and off-diagonal contributions.
+ */
+static void mul_bfmatrix_lfvector_threaded(float (*to)[3],
+                                           const fmatrix3x3 *from,
+                                           const BigMatrixRowMap &map,
+                                           const lfVector *fLongVector)
+{
+  const blender::OffsetIndices<int> row_offsets(map.row_offsets);
+  const blender::OffsetIndices<int> col_offsets(map.col_offsets);
+  blender::threading::parallel_for(
+      blender::IndexRange(from[0].vcount),
+      CLOTH_PARALLEL_GRAIN_SIZE,
+      [&](const blender::IndexRange range) {
+        for (const int64_t vert : range) {
+          float sum[3] = {0.0f, 0.0f, 0.0f};
+          muladd_fmatrix_fvector(sum, from[vert].m, fLongVector[vert]);
+          for (const int block_i : map.row_blocks.as_span().slice(row_offsets[vert])) {
+            const fmatrix3x3 &block = from[block_i];
+            muladd_fmatrix_fvector(sum, block.m, fLongVector[block.c]);
+          }
+          for (const int block_i : map.col_blocks.as_span().slice(col_offsets[vert])) {
+            /* This is the lower triangle of the sparse matrix,
+             * therefore multiplication occurs with transposed sub-matrices. */
+            const fmatrix3x3 &block = from[block_i];
+            muladd_fmatrixT_fvector(sum, block.m, fLongVector[block.r]);
+          }
+          copy_v3_v3(to[vert], sum);
+        }
+      });
+}
+
 /* SPARSE SYMMETRIC sub big matrix with big matrix. */
 /* A -= B * float + C * float --> for big matrix */
 /* VERIFIED */
@@ -839,6 +922,10 @@ static int cg_filtered(lfVector *ldV,
   lfVector *s = create_lfvector(numverts);
   float bnorm2, delta_new, delta_old, delta_target, alpha;
 
+  /* The sparsity pattern of A doesn't change while iterating. */
+  BigMatrixRowMap lA_map;
+  build_bfmatrix_row_map(lA, lA_map);
+
   cp_lfvector(ldV, z, numverts);
 
   /* d0 = filter(B)^T * P * filter(B) */
@@ -848,7 +935,7 @@ static int cg_filtered(lfVector *ldV,
   delta_target = conjgrad_epsilon * conjgrad_epsilon * bnorm2;
 
   /* r = filter(B - A * dV) */
-  mul_bfmatrix_lfvector(AdV, lA, ldV);
+  mul_bfmatrix_lfvector_threaded(AdV, lA, lA_map, ldV);
   sub_lfvector_lfvector(r, lB, AdV, numverts);
   filter(r, S);
 
@@ -871,7 +958,7 @@ static int cg_filtered(lfVector *ldV,
 #  endif
 
   while (delta_new > delta_target && conjgrad_loopcount < conjgrad_looplimit) {
-    mul_bfmatrix_lfvector(q, lA, c);
+    mul_bfmatrix_lfvector_threaded(q, lA, lA_map, c);
     filter(q, S);
 
     alpha = delta_new / dot_lfvector(c, q, numverts);
@@ -1979,6 +1979,117 @@ static bool wm_file_write_check_with_report_on_failure(Main *bmain,
   return true;
 }
 
+/**
+ * Data of a background save: the blend-file data was collected on the main thread already,
+ * the job only writes it to disk.
+ */
+struct FileWriteJob {
+  BlendFileWriteSnapshot *snapshot;
+  char filepath[FILE_MAX];
+  /** Thumbnail to store once the file exists (owned). */
+  ImBuf *ibuf_thumb;
+  bool success;
+};
+
+static void wm_file_write_job_startjob(void *customdata, wmJobWorkerStatus *worker_status)
+{
+  FileWriteJob *write_job = static_cast<FileWriteJob *>(customdata);
+  write_job->success = BLO_write_file_snapshot_commit(
+      write_job->snapshot, &worker_status->progress, worker_status->reports);
+  worker_status->do_update = true;
+}
+
+static void wm_file_write_job_endjob(void *customdata)
+{
+  FileWriteJob *write_job = static_cast<FileWriteJob *>(customdata);
+  Main *bmain = G_MAIN;
+
+  if (write_job->success) {
+    /* Run this function after because the file can't be written before the blend is. */
+    if (write_job->ibuf_thumb) {
+      IMB_thumb_delete(write_job->filepath, THB_FAIL);
+      write_job->ibuf_thumb = IMB_thumb_create(
+          write_job->filepath, THB_LARGE, THB_SOURCE_BLEND, write_job->ibuf_thumb);
+    }
+    WM_reportf(RPT_INFO, "Saved \"%s\"", BLI_path_basename(write_job->filepath));
+  }
+  else {
+    /* The data in memory is not on disk. */
+    WM_file_tag_modified();
+  }
+
+  BKE_callback_exec_string(bmain,
+                           write_job->success ? BKE_CB_EVT_SAVE_POST : BKE_CB_EVT_SAVE_POST_FAIL,
+                           write_job->filepath);
+}
+
+static void wm_file_write_job_free(void *customdata)
+{
+  FileWriteJob *write_job = static_cast<FileWriteJob *>(customdata);
+  BLO_write_file_snapshot_free(write_job->snapshot);
+  if (write_job->ibuf_thumb) {
+    IMB_freeImBuf(write_job->ibuf_thumb);
+  }
+  MEM_freeN(write_job);
+}
+
+static bool wm_file_write_use_background(bContext *C)
+{
+  return USER_EXPERIMENTAL_TEST(&U, use_background_save) && !G.background &&
+         BLI_thread_is_main() && CTX_wm_manager(C) != nullptr;
+}
+
+/**
+ * Collect the blend-file data and write it to disk in a job, the save-post callbacks run once
+ * the job finished. Saving again waits for the previous save to finish.
+ *
+ * \param ibuf_thumb: Thumbnail to store once the file is written, ownership is taken.
+ * \return False if the data could not be collected.
+ */
+static bool wm_file_write_background(bContext *C,
+                                     const char *filepath,
+                                     const int fileflags,
+                                     const BlendFileWriteParams *params,
+                                     ImBuf *ibuf_thumb,
+                                     ReportList *reports)
+{
+  Main *bmain = CTX_data_main(C);
+  wmWindowManager *wm = CTX_wm_manager(C);
+
+  /* The job doesn't check for being stopped (to never leave a partial file behind), so this
+   * waits for the previous save to be written. */
+  WM_jobs_kill_type(wm, bmain, WM_JOB_TYPE_FILE_WRITE);
+
+  BlendFileWriteSnapshot *snapshot = BLO_write_file_snapshot(
+      bmain, filepath, fileflags, params, reports);
+  if (snapshot == nullptr) {
+    if (ibuf_thumb) {
+      IMB_freeImBuf(ibuf_thumb);
+    }
+    return false;
+  }
+
+  FileWriteJob *write_job = static_cast<FileWriteJob *>(
+      MEM_callocN(sizeof(FileWriteJob), __func__));
+  write_job->snapshot = snapshot;
+  STRNCPY(write_job->filepath, filepath);
+  write_job->ibuf_thumb = ibuf_thumb;
+
+  wmJob *wm_job = WM_jobs_get(wm,
+                              CTX_wm_window(C),
+                              bmain,
+                              "Saving...",
+                              WM_JOB_PROGRESS,
+                              WM_JOB_TYPE_FILE_WRITE);
+  WM_jobs_customdata_set(wm_job, write_job, wm_file_write_job_free);
+  WM_jobs_timer(wm_job, 0.1, NC_WM | ND_JOB, NC_WM | ND_JOB);
+  WM_jobs_callbacks(
+      wm_job, wm_file_write_job_startjob, nullptr, nullptr, wm_file_write_job_endjob);
+  WM_jobs_start(wm, wm_job);
+
+  return true;
+}
+
 /**
  * \see #wm_homefile_write_exec wraps #BLO_write_file in a similar way.
  */
@@ -2088,7 +2199,17 @@ static bool wm_file_write(bContext *C,
   blend_write_params.use_save_as_copy = use_save_as_copy;
   blend_write_params.thumb = thumb;
 
-  const bool success = BLO_write_file(bmain, filepath, fileflags, &blend_write_params, reports);
+  /* The thumbnail, reports and save-post callbacks are handled by the job. */
+  const bool use_background = wm_file_write_use_background(C);
+  bool success;
+  if (use_background) {
+    success = wm_file_write_background(
+        C, filepath, fileflags, &blend_write_params, ibuf_thumb, reports);
+    ibuf_thumb = nullptr;
+  }
+  else {
+    success = BLO_write_file(bmain, filepath, fileflags, &blend_write_params, reports);
+  }
 
   if (success) {
     const bool do_history_file_update = (G.background == false) &&
@@ -2112,11 +2233,15 @@ static bool wm_file_write(bContext *C,
     }
 
     /* Without this there is no feedback the file was saved. */
-    BKE_reportf(reports, RPT_INFO, "Saved \"%s\"", BLI_path_basename(filepath));
+    if (!use_background) {
+      BKE_reportf(reports, RPT_INFO, "Saved \"%s\"", BLI_path_basename(filepath));
+    }
   }
 
-  BKE_callback_exec_string(
-      bmain, success ? BKE_CB_EVT_SAVE_POST : BKE_CB_EVT_SAVE_POST_FAIL, filepath);
+  if (!(use_background && success)) {
+    BKE_callback_exec_string(
+        bmain, success ? BKE_CB_EVT_SAVE_POST : BKE_CB_EVT_SAVE_POST_FAIL, filepath);
+  }
 
   if (ibuf_thumb) {
     IMB_freeImBuf(ibuf_thumb);
@@ -2159,6 +2284,59 @@ static void wm_autosave_location(char filepath[FILE_MAX])
   BLI_path_join(filepath, FILE_MAX, tempdir_base, filename);
 }
 
+/** Extension appended to the auto-save file path for incremental auto-save journals. */
+#define AUTOSAVE_JOURNAL_EXT ".journal"
+
+/** State of the incremental auto-save journal, kept between auto-saves. */
+static BlendFileJournal *wm_autosave_journal = nullptr;
+
+static void wm_autosave_journal_location(char filepath[FILE_MAX])
+{
+  char autosave_filepath[FILE_MAX];
+  wm_autosave_location(autosave_filepath);
+  BLI_snprintf(filepath, FILE_MAX, "%s" AUTOSAVE_JOURNAL_EXT, autosave_filepath);
+}
+
+/**
+ * Turn the journal of the auto-save at \a filepath (if any) into a regular blend-file,
+ * unless the blend-file is more recent than the journal.
+ */
+static void wm_autosave_journal_restore(const char *filepath, ReportList *reports)
+{
+  char journal_filepath[FILE_MAX];
+  BLI_snprintf(journal_filepath, sizeof(journal_filepath), "%s" AUTOSAVE_JOURNAL_EXT, filepath);
+  if (!BLI_exists(journal_filepath)) {
+    return;
+  }
+  if (BLI_exists(filepath) && BLI_file_older(journal_filepath, filepath)) {
+    return;
+  }
+  BLO_journal_restore(journal_filepath, filepath, reports);
+}
+
+/** Restore the auto-save journals of other (crashed) sessions, so they can be recovered. */
+static void wm_autosave_journal_restore_all(ReportList *reports)
+{
+  char journal_filepath_current[FILE_MAX];
+  wm_autosave_journal_location(journal_filepath_current);
+
+  direntry *filelist;
+  const uint filelist_num = BLI_filelist_dir_contents(BKE_tempdir_base(), &filelist);
+  for (uint i = 0; i < filelist_num; i++) {
+    const char *journal_filepath = filelist[i].path;
+    if (!BLI_path_extension_check(journal_filepath, ".blend" AUTOSAVE_JOURNAL_EXT) ||
+        BLI_path_cmp(journal_filepath, journal_filepath_current) == 0)
+    {
+      continue;
+    }
+    char filepath[FILE_MAX];
+    STRNCPY(filepath, journal_filepath);
+    filepath[strlen(filepath) - strlen(AUTOSAVE_JOURNAL_EXT)] = '\0';
+    wm_autosave_journal_restore(filepath, reports);
+  }
+  BLI_filelist_free(filelist, filelist_num);
+}
+
 static bool wm_autosave_write_try(Main *bmain, wmWindowManager *wm)
 {
   char filepath[FILE_MAX];
@@ -2190,14 +2368,27 @@ void WM_autosave_write(wmWindowManager *wm, Main *bmain)
 {
   ED_editors_flush_edits(bmain);
 
-  char filepath[FILE_MAX];
-  wm_autosave_location(filepath);
   /* Save as regular blend file with recovery information. */
   const int fileflags = (G.fileflags & ~G_FILE_COMPRESS) | G_FILE_RECOVER_WRITE;
 
-  /* Error reporting into console. */
-  BlendFileWriteParams params{};
-  BLO_write_file(bmain, filepath, fileflags, &params, nullptr);
+  if (USER_EXPERIMENTAL_TEST(&U, use_autosave_journal)) {
+    /* Only write the data that changed since the previous auto-save. */
+    char journal_filepath[FILE_MAX];
+    wm_autosave_journal_location(journal_filepath);
+    if (wm_autosave_journal == nullptr) {
+      wm_autosave_journal = BLO_journal_new();
+    }
+    /* Error reporting into console. */
+    BLO_write_file_journal(bmain, journal_filepath, fileflags, nullptr, wm_autosave_journal);
+  }
+  else {
+    char filepath[FILE_MAX];
+    wm_autosave_location(filepath);
+
+    /* Error reporting into console. */
+    BlendFileWriteParams params{};
+    BLO_write_file(bmain, filepath, fileflags, &params, nullptr);
+  }
 
   /* Restart auto-save timer. */
   wm_autosave_timer_end(wm);
@@ -2277,6 +2468,24 @@ void wm_autosave_delete()
       BLI_rename_overwrite(filepath, filepath_quit);
     }
   }
+
+  char journal_filepath[FILE_MAX];
+  wm_autosave_journal_location(journal_filepath);
+
+  if (BLI_exists(journal_filepath)) {
+    /* Same as above, the journal is restored as a regular file to be renamed. */
+    if ((U.uiflag & USER_GLOBALUNDO) == 0) {
+      char filepath_quit[FILE_MAX];
+      BLI_path_join(filepath_quit, sizeof(filepath_quit), BKE_tempdir_base(), BLENDER_QUIT_FILE);
+      BLO_journal_restore(journal_filepath, filepath_quit, nullptr);
+    }
+    BLI_delete(journal_filepath, false, false);
+  }
+
+  if (wm_autosave_journal) {
+    BLO_journal_free(wm_autosave_journal);
+    wm_autosave_journal = nullptr;
+  }
 }
 
 /** \} */
@@ -3365,6 +3574,8 @@ static int wm_recover_auto_save_exec(bContext *C, wmOperator *op)
   RNA_string_get(op->ptr, "filepath", filepath);
   BLI_path_canonicalize_native(filepath, sizeof(filepath));
 
+  wm_autosave_journal_restore(filepath, op->reports);
+
   wm_open_init_use_scripts(op, true);
   SET_FLAG_FROM_TEST(G.f, RNA_boolean_get(op->ptr, "use_scripts"), G_FLAG_SCRIPT_AUTOEXEC);
 
@@ -3391,6 +3602,9 @@ static int wm_recover_auto_save_invoke(bContext *C, wmOperator *op, const wmEven
 {
   char filepath[FILE_MAX];
 
+  /* Journals of crashed sessions need to be converted to be listed. */
+  wm_autosave_journal_restore_all(op->reports);
+
   wm_autosave_location(filepath);
   RNA_string_set(op->ptr, "filepath", filepath);
   wm_open_init_use_scripts(op, true);
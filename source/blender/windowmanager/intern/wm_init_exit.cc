@@ -27,6 +27,7 @@
 #include "BLI_string.h"
 #include "BLI_task.h"
 #include "BLI_threads.h"
+#include "BLI_time.h"
 #include "BLI_timer.h"
 #include "BLI_utildefines.h"
 
@@ -122,6 +123,8 @@ CLG_LOGREF_DECLARE_GLOBAL(WM_LOG_TOOLS, "wm.tool");
 CLG_LOGREF_DECLARE_GLOBAL(WM_LOG_MSGBUS_PUB, "wm.msgbus.pub");
 CLG_LOGREF_DECLARE_GLOBAL(WM_LOG_MSGBUS_SUB, "wm.msgbus.sub");
 
+static CLG_LogRef LOG_STARTUP = {"wm.startup"};
+
 static void wm_init_scripts_extensions_once(bContext *C);
 
 static bool wm_start_with_console = false;
@@ -194,14 +197,32 @@ static void sound_jack_sync_callback(Main *bmain, int mode, double time)
   }
 }
 
+/**
+ * Report the time spent in one stage of #WM_init, use `--log "wm.startup"` to show this.
+ */
+static void wm_init_stage_log(const char *stage, const double time_start, double *time_prev)
+{
+  const double time = BLI_time_now_seconds();
+  CLOG_INFO(&LOG_STARTUP,
+            1,
+            "%s: %.2f ms (total %.2f ms)",
+            stage,
+            (time - *time_prev) * 1000.0,
+            (time - time_start) * 1000.0);
+  *time_prev = time;
+}
+
 void WM_init(bContext *C, int argc, const char **argv)
 {
+  const double time_start = BLI_time_now_seconds();
+  double time_prev = time_start;
 
   if (!G.background) {
     wm_ghost_init(C); /* NOTE: it assigns C to ghost! */
     wm_init_cursor_data();
     BKE_sound_jack_sync_callback_set(sound_jack_sync_callback);
   }
+  wm_init_stage_log("window system", time_start, &time_prev);
 
   BKE_addon_pref_type_init();
   BKE_keyconfig_pref_type_init();
@@ -215,6 +236,7 @@ void WM_init(bContext *C, int argc, const char **argv)
   wm_gizmogrouptype_init();
 
   ED_undosys_type_init();
+  wm_init_stage_log("type registration", time_start, &time_prev);
 
   BKE_library_callback_free_notifier_reference_set(WM_main_remove_notifier_reference);
   BKE_region_callback_free_gizmomap_set(wm_gizmomap_remove);
@@ -233,6 +255,7 @@ void WM_init(bContext *C, int argc, const char **argv)
   /* Must call first before doing any `.blend` file reading,
    * since versioning code may create new IDs. See #57066. */
   BLT_lang_set(nullptr);
+  wm_init_stage_log("space types, fonts & translation", time_start, &time_prev);
 
   /* Init icons & previews before reading .blend files for preview icons, which can
    * get triggered by the depsgraph. This is also done in background mode
@@ -245,6 +268,7 @@ void WM_init(bContext *C, int argc, const char **argv)
   /* Studio-lights needs to be init before we read the home-file,
    * otherwise the versioning cannot find the default studio-light. */
   BKE_studiolight_init();
+  wm_init_stage_log("icons & studio-lights", time_start, &time_prev);
 
   BLI_assert((G.fileflags & G_FILE_NO_UI) == 0);
 
@@ -277,6 +301,7 @@ void WM_init(bContext *C, int argc, const char **argv)
   read_homefile_params.is_first_time = true;
 
   wm_homefile_read_ex(C, &read_homefile_params, nullptr, &params_file_read_post);
+  wm_init_stage_log("home-file read", time_start, &time_prev);
 
   /* NOTE: leave `G_MAIN->filepath` set to an empty string since this
    * matches behavior after loading a new file. */
@@ -306,6 +331,7 @@ void WM_init(bContext *C, int argc, const char **argv)
     GPU_context_end_frame(GPU_context_active_get());
     GPU_render_end();
   }
+  wm_init_stage_log("GPU & UI", time_start, &time_prev);
 
   blender::bke::subdiv::init();
 
@@ -314,6 +340,7 @@ void WM_init(bContext *C, int argc, const char **argv)
 #ifdef WITH_PYTHON
   BPY_python_start(C, argc, argv);
   BPY_python_reset(C);
+  wm_init_stage_log("Python", time_start, &time_prev);
 #else
   UNUSED_VARS(argc, argv);
 #endif
@@ -344,15 +371,18 @@ void WM_init(bContext *C, int argc, const char **argv)
   WM_keyconfig_update_postpone_begin();
 
   WM_keyconfig_init(C);
+  wm_init_stage_log("key-maps", time_start, &time_prev);
 
   /* Load add-ons after key-maps have been initialized (but before the blend file has been read),
    * important to guarantee default key-maps have been declared & before post-read handlers run. */
   wm_init_scripts_extensions_once(C);
+  wm_init_stage_log("add-ons & extensions", time_start, &time_prev);
 
   WM_keyconfig_update_postpone_end();
   WM_keyconfig_update(static_cast<wmWindowManager *>(G_MAIN->wm.first));
 
   wm_homefile_read_post(C, params_file_read_post);
+  wm_init_stage_log("home-file post-read", time_start, &time_prev);
 }
 
 static bool wm_init_splash_show_on_startup_check()